@@ -155,8 +155,13 @@ RawSourceItemModel::RawSourceItemModel(const GeneralSettings * const generalSett
 
 void RawSourceItemModel::setDynamicItemData(QStandardItem * item, const RawSource & src) const
 {
-  item->setText(src.toString(modelData, generalSettings, boardType));
-  item->setData(src.isAvailable(modelData, generalSettings, boardType), IMDR_Available);
+  // avoid dataChanged() signals for unchanged items
+  const QString text = src.toString(modelData, generalSettings, boardType);
+  if (item->text() != text)
+    item->setText(text);
+  const bool available = src.isAvailable(modelData, generalSettings, boardType);
+  if (item->data(IMDR_Available) != QVariant(available))
+    item->setData(available, IMDR_Available);
 }
 
 void RawSourceItemModel::addItems(const RawSourceType & type, const int group, int count, const int start)
@@ -174,6 +179,7 @@ void RawSourceItemModel::addItems(const RawSourceType & type, const int group, i
     modelItem->setData((group | (i + idxAdj < 0 ? RawSource::NegativeGroup : i > 0 ? RawSource::PositiveGroup : 0)), IMDR_Flags);
     setDynamicItemData(modelItem, src);
     appendRow(modelItem);
+    m_rows.insert(itemKey(type, i + idxAdj), rowCount() - 1);
   }
 }
 
@@ -189,6 +195,49 @@ void RawSourceItemModel::update(const int event)
   }
 }
 
+void RawSourceItemModel::updateItems(const int event, const int first, const int last)
+{
+  RawSourceType type;
+  int count = 1;  // sources per data item
+
+  switch (event) {
+    case IMUE_Channels:
+      type = SOURCE_TYPE_CH;
+      break;
+    case IMUE_GVars:
+      type = SOURCE_TYPE_GVAR;
+      break;
+    case IMUE_Inputs:
+      type = SOURCE_TYPE_VIRTUAL_INPUT;
+      break;
+    case IMUE_LogicalSwitches:
+      type = SOURCE_TYPE_CUSTOM_SWITCH;
+      break;
+    case IMUE_Timers:
+      type = SOURCE_TYPE_TIMER;
+      break;
+    case IMUE_TeleSensors:
+      type = SOURCE_TYPE_TELEMETRY;
+      count = 3;  // value, min and max
+      break;
+    default:
+      update(event);
+      return;
+  }
+
+  if (doUpdate(event)) {
+    emit aboutToBeUpdated();
+
+    // source indexes are one based
+    for (int i = first * count + 1; i <= (last + 1) * count; ++i) {
+      foreach (const int row, m_rows.values(itemKey(type, i)))
+        setDynamicItemData(item(row), RawSource(item(row)->data(IMDR_Id).toInt()));
+    }
+
+    emit updateComplete();
+  }
+}
+
 //
 // RawSwitchItemModel
 //
@@ -228,8 +277,13 @@ RawSwitchItemModel::RawSwitchItemModel(const GeneralSettings * const generalSett
 
 void RawSwitchItemModel::setDynamicItemData(QStandardItem * item, const RawSwitch & rsw) const
 {
-  item->setText(rsw.toString(boardType, generalSettings, modelData));
-  item->setData(rsw.isAvailable(modelData, generalSettings, boardType), IMDR_Available);
+  // avoid dataChanged() signals for unchanged items
+  const QString text = rsw.toString(boardType, generalSettings, modelData);
+  if (item->text() != text)
+    item->setText(text);
+  const bool available = rsw.isAvailable(modelData, generalSettings, boardType);
+  if (item->data(IMDR_Available) != QVariant(available))
+    item->setData(available, IMDR_Available);
 }
 
 void RawSwitchItemModel::addItems(const RawSwitchType & type, int count)
@@ -275,6 +329,7 @@ void RawSwitchItemModel::addItems(const RawSwitchType & type, int count)
     modelItem->setData(context, IMDR_Flags);
     setDynamicItemData(modelItem, rs);
     appendRow(modelItem);
+    m_rows.insert(itemKey(type, i + rawIdxAdj), rowCount() - 1);
   }
 }
 
@@ -290,6 +345,38 @@ void RawSwitchItemModel::update(const int event)
   }
 }
 
+void RawSwitchItemModel::updateItems(const int event, const int first, const int last)
+{
+  RawSwitchType type;
+
+  switch (event) {
+    case IMUE_FlightModes:
+      type = SWITCH_TYPE_FLIGHT_MODE;
+      break;
+    case IMUE_LogicalSwitches:
+      type = SWITCH_TYPE_VIRTUAL;
+      break;
+    case IMUE_TeleSensors:
+      type = SWITCH_TYPE_SENSOR;
+      break;
+    default:
+      update(event);
+      return;
+  }
+
+  if (doUpdate(event)) {
+    emit aboutToBeUpdated();
+
+    // switch indexes are one based
+    for (int i = first + 1; i <= last + 1; ++i) {
+      foreach (const int row, m_rows.values(itemKey(type, i)))
+        setDynamicItemData(item(row), RawSwitch(item(row)->data(IMDR_Id).toInt()));
+    }
+
+    emit updateComplete();
+  }
+}
+
 //
 // CurveItemModel
 //
@@ -793,6 +880,13 @@ void CompoundItemModelFactory::update(const int event)
   }
 }
 
+void CompoundItemModelFactory::update(const int event, const int first, const int last)
+{
+  foreach (AbstractItemModel * itemModel, registeredItemModels) {
+    itemModel->updateItems(event, first, last);
+  }
+}
+
 void CompoundItemModelFactory::dumpAllItemModelContents() const
 {
   foreach (AbstractItemModel * itemModel, registeredItemModels) {
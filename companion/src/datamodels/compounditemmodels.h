@@ -24,6 +24,7 @@
 #include "rawsource.h"
 #include "rawswitch.h"
 
+#include <QHash>
 #include <QStandardItemModel>
 
 class GeneralSettings;
@@ -117,6 +118,8 @@ class AbstractItemModel: public QStandardItemModel
 
   public slots:
     virtual void update(const int event = IMUE_SystemRefresh) = 0;
+    // update only the items of the event data type with (zero based) index in [first, last]
+    virtual void updateItems(const int event, const int first, const int last) { update(event); }
 
   protected:
     const GeneralSettings * generalSettings;
@@ -195,10 +198,14 @@ class RawSourceItemModel: public AbstractDynamicItemModel
 
   public slots:
     virtual void update(const int event = IMUE_SystemRefresh) override;
+    virtual void updateItems(const int event, const int first, const int last) override;
 
   protected:
     virtual void setDynamicItemData(QStandardItem * item, const RawSource & src) const;
     void addItems(const RawSourceType & type, const int group, int count, const int start = 0);
+
+    QMultiHash<int, int> m_rows;  // rows by item key
+    static int itemKey(const int type, const int index) { return (type << 16) | (abs(index) & 0xFFFF); }
 };
 
 class RawSwitchItemModel: public AbstractDynamicItemModel
@@ -211,10 +218,14 @@ class RawSwitchItemModel: public AbstractDynamicItemModel
 
   public slots:
     virtual void update(const int event = IMUE_SystemRefresh) override;
+    virtual void updateItems(const int event, const int first, const int last) override;
 
   protected:
     virtual void setDynamicItemData(QStandardItem * item, const RawSwitch & rsw) const;
     void addItems(const RawSwitchType & type, int count);
+
+    QMultiHash<int, int> m_rows;  // rows by item key
+    static int itemKey(const int type, const int index) { return (type << 16) | (abs(index) & 0xFFFF); }
 };
 
 class CurveItemModel: public AbstractDynamicItemModel
@@ -368,6 +379,7 @@ class CompoundItemModelFactory
     AbstractItemModel * getItemModel(const int id) const;
     AbstractItemModel * getItemModel(const QString name) const;
     void update(const int event = AbstractItemModel::IMUE_SystemRefresh);
+    void update(const int event, const int first, const int last);
     void dumpAllItemModelContents() const;
 
   protected:
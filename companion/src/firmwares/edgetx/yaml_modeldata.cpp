@@ -43,6 +43,7 @@
 #include <string>
 #include <QMessageBox>
 #include <QPushButton>
+#include <QThread>
 
 void YamlValidateLabelsNames(ModelData& model, Board::Type board)
 {
@@ -1340,6 +1341,11 @@ bool convert<ModelData>::decode(const Node& node, ModelData& rhs)
 
   //  TODO display model filename in preference to model name as easier for user
   if (modelSettingsVersion > SemanticVersion(VERSION)) {
+    // models may be decoded in worker threads: let the caller retry
+    // from the UI thread, where the user can be asked
+    if (QThread::currentThread() != QCoreApplication::instance()->thread())
+      return false;
+
     QString prmpt = QCoreApplication::translate("YamlModelSettings", "Warning: '%1' has settings version %2 that is not supported by this version of Companion!\n\nModel settings may be corrupted if you continue.");
     prmpt = prmpt.arg(rhs.name).arg(modelSettingsVersion.toString());
     QMessageBox msgBox;
@@ -180,4 +180,5 @@ struct convert_enum
   }
 
 extern SemanticVersion radioSettingsVersion;
-extern SemanticVersion modelSettingsVersion;
+// per thread, as models may be decoded concurrently
+extern thread_local SemanticVersion modelSettingsVersion;
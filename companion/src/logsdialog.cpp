@@ -30,17 +30,177 @@
 #include <unistd.h>
 #endif
 
+#include <algorithm>
+
+void LogData::clear()
+{
+  header.clear();
+  records.clear();
+  time.clear();
+  columns.clear();
+}
+
+QString LogData::field(int record, int index) const
+{
+  const QByteArray & line = records.at(record);
+  int start = 0;
+  for (int i = 0; i < index; i++) {
+    start = line.indexOf(',', start) + 1;
+    if (start == 0)
+      return QString();
+  }
+  int end = line.indexOf(',', start);
+  if (end < 0)
+    end = line.size();
+  return QString::fromUtf8(line.constData() + start, end - start);
+}
+
+QStringList LogData::fields(int record) const
+{
+  return QString::fromUtf8(records.at(record)).split(',');
+}
+
+LogsTableModel::LogsTableModel(const LogData & log, QObject * parent) :
+  QAbstractTableModel(parent),
+  log(log)
+{
+}
+
+int LogsTableModel::rowCount(const QModelIndex & parent) const
+{
+  return parent.isValid() ? 0 : log.count();
+}
+
+int LogsTableModel::columnCount(const QModelIndex & parent) const
+{
+  return parent.isValid() ? 0 : log.header.count();
+}
+
+QVariant LogsTableModel::data(const QModelIndex & index, int role) const
+{
+  if (!index.isValid() || role != Qt::DisplayRole)
+    return QVariant();
+
+  return log.field(index.row(), index.column());
+}
+
+QVariant LogsTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+  if (orientation == Qt::Horizontal && role == Qt::DisplayRole && section < log.header.count())
+    return log.header.at(section);
+
+  return QAbstractTableModel::headerData(section, orientation, role);
+}
+
+void LogsTableModel::reset()
+{
+  beginResetModel();
+  endResetModel();
+}
+
+static double parseRecordTime(const QByteArray & date, const QByteArray & time)
+{
+  QString time_str = QString::fromLatin1(date) + QString(" ") + QString::fromLatin1(time);
+  QDateTime dt;
+  double fraction = 0;
+
+  if (time_str.contains('.')) {
+    dt = QDateTime::fromString(time_str, "yyyy-MM-dd HH:mm:ss.zzz");
+    fraction = time_str.mid(time_str.indexOf('.')).toDouble();
+  } else {
+    dt = QDateTime::fromString(time_str, "yyyy-MM-dd HH:mm:ss");
+  }
+
+  if (!dt.isValid())
+    return NAN;
+
+  return dt.toMSecsSinceEpoch() + fraction;
+}
+
+// Largest-Triangle-Three-Buckets downsampling: the first and last points
+// are kept, and each bucket in between is reduced to the point forming the
+// largest triangle with the previously kept point and the average of the
+// next bucket
+static void downsampleLttb(const double * x, const double * y, int count, int threshold,
+                           QVector<double> & outX, QVector<double> & outY)
+{
+  outX.clear();
+  outY.clear();
+
+  if (threshold < 3 || threshold >= count) {
+    outX = QVector<double>(x, x + count);
+    outY = QVector<double>(y, y + count);
+    return;
+  }
+
+  outX.reserve(threshold);
+  outY.reserve(threshold);
+
+  double every = (double)(count - 2) / (threshold - 2);
+  int a = 0;
+
+  outX.append(x[a]);
+  outY.append(y[a]);
+
+  for (int i = 0; i < threshold - 2; i++) {
+    int avgStart = (int)((i + 1) * every) + 1;
+    int avgEnd = std::min((int)((i + 2) * every) + 1, count);
+    double avgX = 0, avgY = 0;
+    for (int j = avgStart; j < avgEnd; j++) {
+      avgX += x[j];
+      avgY += y[j];
+    }
+    if (avgEnd > avgStart) {
+      avgX /= avgEnd - avgStart;
+      avgY /= avgEnd - avgStart;
+    }
+
+    int rangeStart = (int)(i * every) + 1;
+    int rangeEnd = (int)((i + 1) * every) + 1;
+    double maxArea = -1;
+    int next = rangeStart;
+    for (int j = rangeStart; j < rangeEnd; j++) {
+      double area = fabs((x[a] - avgX) * (y[j] - y[a]) - (x[a] - x[j]) * (avgY - y[a]));
+      if (area > maxArea) {
+        maxArea = area;
+        next = j;
+      }
+    }
+
+    outX.append(x[next]);
+    outY.append(y[next]);
+    a = next;
+  }
+
+  outX.append(x[count - 1]);
+  outY.append(y[count - 1]);
+}
+
+// index of the point with the closest key
+static int findNearestKey(const QVector<double> & keys, double key)
+{
+  auto it = std::lower_bound(keys.constBegin(), keys.constEnd(), key);
+  if (it == keys.constEnd())
+    return keys.count() - 1;
+  int index = it - keys.constBegin();
+  if (index > 0 && key - keys.at(index - 1) < keys.at(index) - key)
+    index--;
+  return index;
+}
+
 LogsDialog::LogsDialog(QWidget *parent) :
   QDialog(parent, Qt::WindowTitleHint | Qt::WindowSystemMenuHint),
   ui(new Ui::LogsDialog),
   tracerMaxAlt(0),
   cursorA(0),
   cursorB(0),
-  cursorLine(0)
+  cursorLine(0),
+  altitudeGraph(-1)
 {
-  csvlog.clear();
-
   ui->setupUi(this);
+
+  logModel = new LogsTableModel(log, this);
+  ui->logTable->setModel(logModel);
   setWindowIcon(CompanionIcon("logs.png"));
 
   plotLock=false;
@@ -117,12 +277,14 @@ LogsDialog::LogsDialog(QWidget *parent) :
 
   // make left axes transfer its range to right axes:
   connect(axisRect->axis(QCPAxis::atLeft), static_cast<void(QCPAxis::*)(const QCPRange&)>(&QCPAxis::rangeChanged), this, &LogsDialog::yAxisChangeRanges);
+  // resample graphs data for the visible time range:
+  connect(axisRect->axis(QCPAxis::atBottom), static_cast<void(QCPAxis::*)(const QCPRange&)>(&QCPAxis::rangeChanged), this, &LogsDialog::xAxisChangeRange);
   // connect some interaction slots:
   connect(title, &QCPTextElement::doubleClicked, this, &LogsDialog::titleDoubleClicked);
   connect(ui->customPlot, &QCustomPlot::axisDoubleClick, this, &LogsDialog::axisLabelDoubleClick);
   connect(ui->customPlot, &QCustomPlot::legendDoubleClick, this, &LogsDialog::legendDoubleClick);
   connect(ui->FieldsTW, &QTableWidget::itemSelectionChanged, this, &LogsDialog::plotLogs);
-  connect(ui->logTable, &QTableWidget::itemSelectionChanged, this, &LogsDialog::plotLogs);
+  connect(ui->logTable->selectionModel(), &QItemSelectionModel::selectionChanged, this, &LogsDialog::plotLogs);
   connect(ui->Reset_PB, &QPushButton::clicked, this, &LogsDialog::plotLogs);
   connect(ui->SaveSession_PB, &QPushButton::clicked, this, &LogsDialog::saveSession);
   connect(ui->fileOpen_PB, &QPushButton::clicked, this, &LogsDialog::fileOpen);
@@ -248,18 +410,18 @@ void LogsDialog::selectionChanged()
   }
 }
 
-QList<QStringList> LogsDialog::filterGePoints(const QList<QStringList> & input)
+QList<QStringList> LogsDialog::filterGePoints()
 {
   QList<QStringList> result;
 
-  int n = input.count();
+  int n = log.count();
   if (n == 0) {
     return result;
   }
 
   int gpscol = 0;
-  for (int i=1; i<input.at(0).count(); i++) {
-    if (input.at(0).at(i) == "GPS") {
+  for (int i=1; i<log.header.count(); i++) {
+    if (log.header.at(i) == "GPS") {
       gpscol=i;
     }
   }
@@ -270,16 +432,16 @@ The columns for altitude \"GAlt\" and for speed \"GSpd\" are optional"));
     return result;
   }
 
-  result.append(input.at(0));
-  bool rangeSelected = ui->logTable->selectionModel()->selectedRows().length() > 0;
+  result.append(log.header);
+  bool rangeSelected = ui->logTable->selectionModel()->hasSelection();
 
   GpsGlitchFilter glitchFilter;
   GpsLatLonFilter latLonFilter;
 
-  for (int i = 1; i < n; i++) {
-    if ((ui->logTable->item(i-1, 1)->isSelected() && rangeSelected) || !rangeSelected) {
+  for (int i = 0; i < n; i++) {
+    if ((ui->logTable->selectionModel()->isRowSelected(i) && rangeSelected) || !rangeSelected) {
 
-      GpsCoord coord = extractGpsCoordinates(input.at(i).at(gpscol));
+      GpsCoord coord = extractGpsCoordinates(log.field(i, gpscol));
 
       // glitch filter
       if ( glitchFilter.isGlitch(coord) ) {
@@ -294,7 +456,7 @@ The columns for altitude \"GAlt\" and for speed \"GSpd\" are optional"));
       }
 
       // qDebug() << "point " << latitude << longitude;
-      result.append(input.at(i));
+      result.append(log.fields(i));
     }
   }
 
@@ -305,7 +467,7 @@ The columns for altitude \"GAlt\" and for speed \"GSpd\" are optional"));
 void LogsDialog::exportToGoogleEarth()
 {
   // filter data points
-  QList<QStringList> dataPoints = filterGePoints(csvlog);
+  QList<QStringList> dataPoints = filterGePoints();
   int n = dataPoints.count(); // number of points to export
   if (n==0) return;
 
@@ -476,9 +638,11 @@ void LogsDialog::placeCursor(double x, bool second)
 {
   QCPItemTracer * cursor = second ? cursorB : cursorA;
 
-  if (cursor) {
-    cursor->setGraphKey(x);
-    cursor->updatePosition();
+  if (cursor && altitudeGraph >= 0) {
+    // lookup in full resolution data, graph data is downsampled
+    const coords_t & c = graphsData.at(altitudeGraph);
+    int index = findNearestKey(c.x, x);
+    cursor->position->setCoords(c.x.at(index), c.y.at(index));
     cursor->setVisible(true);
   }
 
@@ -574,6 +738,8 @@ void LogsDialog::removeAllGraphs()
   cursorA = 0;
   cursorB = 0;
   cursorLine = 0;
+  graphsData.clear();
+  altitudeGraph = -1;
   ui->labelCursors->setText("");
 }
 
@@ -585,36 +751,26 @@ void LogsDialog::fileOpen()
     ui->FileName_LE->setText(fileName);
     if (cvsFileParse()) {
       ui->FieldsTW->clear();
-      ui->logTable->clear();
       ui->FieldsTW->setShowGrid(false);
       ui->FieldsTW->setContentsMargins(0,0,0,0);
-      ui->FieldsTW->setRowCount(csvlog.at(0).count()-2);
+      ui->FieldsTW->setRowCount(log.header.count()-2);
       ui->FieldsTW->setColumnCount(1);
       ui->FieldsTW->setHorizontalHeaderLabels(QStringList(tr("Available fields")));
       ui->logTable->setSelectionBehavior(QAbstractItemView::SelectRows);
-      for (int i=2; i<csvlog.at(0).count(); i++) {
-        QTableWidgetItem* item= new QTableWidgetItem(csvlog.at(0).at(i));
+      for (int i=2; i<log.header.count(); i++) {
+        QTableWidgetItem* item= new QTableWidgetItem(log.header.at(i));
         ui->FieldsTW->setItem(i-2, 0, item);
       }
       ui->FieldsTW->resizeRowsToContents();
-      ui->logTable->setColumnCount(csvlog.at(0).count());
-      ui->logTable->setRowCount(csvlog.count()-1);
-      ui->logTable->setHorizontalHeaderLabels(csvlog.at(0));
-
-      QAbstractItemModel *model = ui->logTable->model();
-      for (int i=1; i<csvlog.count(); i++) {
-        for (int j=0; j<csvlog.at(0).count(); j++) {
-          model->setData(model->index(i - 1, j, QModelIndex()), csvlog.at(i).at(j));
-        }
-      }
 
+      int columnCount = logModel->columnCount();
       ui->logTable->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
       QVarLengthArray<int> sizes;
-      for (int i = 0; i < ui->logTable->columnCount(); i++) {
+      for (int i = 0; i < columnCount; i++) {
         sizes.append(ui->logTable->columnWidth(i));
       }
       ui->logTable->horizontalHeader()->setSectionResizeMode(QHeaderView::Interactive);
-      for (int i = 0; i < ui->logTable->columnCount(); i++) {
+      for (int i = 0; i < columnCount; i++) {
         ui->logTable->setColumnWidth(i, sizes.at(i));
       }
     }
@@ -626,26 +782,11 @@ void LogsDialog::saveSession()
   int index = ui->sessions_CB->currentIndex();
   // ignore index 0 is its all sessions combined
   if(index > 0) {
-    int n = csvlog.count();
-    QList<QStringList> sessionCsvLog;
-    // add CSV headers from first row of source file
-    sessionCsvLog.push_back(csvlog[0]);
-    // find session breaks
-    int currentSession = 0;
-    QDateTime lastvalue;
-    for (int i = 1; i < n; i++) {
-      QDateTime tmp = getRecordTimeStamp(i);
-      if (!lastvalue.isValid() || lastvalue.secsTo(tmp) > 60) {
-        currentSession++;
-      }
-      lastvalue = tmp;
-      if(currentSession == index) {
-        // add records to filtered list
-        sessionCsvLog.push_back(csvlog[i]);
-      }
-      else if (currentSession > index) {
-        break;
-      }
+    // session records, as found by setFlightSessions()
+    int first = ui->sessions_CB->itemData(index, Qt::UserRole).toInt();
+    int last = log.count();
+    if (index < ui->sessions_CB->count() - 1) {
+      last = ui->sessions_CB->itemData(index + 1, Qt::UserRole).toInt();
     }
     // save the filtered records to a new file
     QString newFilename = logFilename;
@@ -654,12 +795,12 @@ void LogsDialog::saveSession()
     QFile data(filename);
     if(data.open(QFile::WriteOnly |QFile::Truncate)) {
       QTextStream output(&data);
-      int numRecords = sessionCsvLog.count();
-      for(int i = 0; i < numRecords; i++){
-        output << sessionCsvLog[i].join(",") << '\n';
+      // add CSV headers from first row of source file
+      output << log.header.join(",") << '\n';
+      for(int i = first; i < last; i++){
+        output << log.records.at(i) << '\n';
       }
     }
-    sessionCsvLog.clear();
   }
 }
 
@@ -673,8 +814,6 @@ bool LogsDialog::cvsFileParse()
     return false;
   }
   else {
-    csvlog.clear();
-    logFilename.clear();
     QTextStream inputStream(&file);
     QString buffer = file.readLine();
 
@@ -685,15 +824,38 @@ bool LogsDialog::cvsFileParse()
       return false;
     }
 
+    log.clear();
+    logModel->reset();
+    logFilename.clear();
+
+    // records are split and converted once, values of each field being
+    // appended to its column
     int numfields=-1;
     while (!file.atEnd()) {
-      QString line = file.readLine().trimmed();
-      QStringList columns = line.split(',');
+      QByteArray line = file.readLine().trimmed();
+      int count = line.count(',') + 1;
       if (numfields==-1) {
-        numfields=columns.count();
+        numfields=count;
+        log.header = QString::fromUtf8(line).split(',');
+        log.columns.resize(numfields - 2);
       }
-      if (columns.count()==numfields) {
-        csvlog.append(columns);
+      else if (count==numfields) {
+        const char * data = line.constData();
+        int date = line.indexOf(',');
+        int time = line.indexOf(',', date + 1);
+        if (time < 0)
+          time = line.size();
+        log.time.append(parseRecordTime(QByteArray::fromRawData(data, date),
+                                        QByteArray::fromRawData(data + date + 1, time - date - 1)));
+        int start = time + 1;
+        for (int i = 0; i < numfields - 2; i++) {
+          int end = line.indexOf(',', start);
+          if (end < 0)
+            end = line.size();
+          log.columns[i].append(QByteArray::fromRawData(data + start, end - start).toDouble());
+          start = end + 1;
+        }
+        log.records.append(line);
       }
       else {
         errors++;
@@ -709,12 +871,14 @@ bool LogsDialog::cvsFileParse()
     QMessageBox::warning(this, CPN_STR_APP_NAME, tr("The selected logfile contains %1 invalid lines out of  %2 total lines").arg(errors).arg(lines));
   }
 
-  int n = csvlog.count();
-  if (n == 1) {
-    csvlog.clear();
+  if (log.count() == 0) {
+    log.clear();
+    logModel->reset();
     return false;
   }
 
+  logModel->reset();
+
   plotLock = true;
   setFlightSessions();
   plotLock = false;
@@ -729,10 +893,10 @@ struct FlightSession {
 
 QDateTime LogsDialog::getRecordTimeStamp(int index)
 {
-  QString tstamp = csvlog.at(index).at(0) + " " + csvlog.at(index).at(1);
-  if (csvlog.at(index).at(1).contains("."))
-    return QDateTime::fromString(tstamp, "yyyy-MM-dd HH:mm:ss.zzz");
-  return QDateTime::fromString(tstamp, "yyyy-MM-dd HH:mm:ss");
+  double time = log.time.at(index);
+  if (std::isnan(time))
+    return QDateTime();
+  return QDateTime::fromMSecsSinceEpoch((qint64)time);
 }
 
 QString LogsDialog::generateDuration(const QDateTime & start, const QDateTime & end)
@@ -752,35 +916,35 @@ void LogsDialog::setFlightSessions()
   ui->sessions_CB->clear();
   ui->SaveSession_PB->setEnabled(false);
 
-  int n = csvlog.count();
+  int n = log.count();
   // qDebug() << "records" << n;
 
   // find session breaks
   QList<int> sessions;
-  QDateTime lastvalue;
-  for (int i = 1; i < n; i++) {
-    QDateTime tmp = getRecordTimeStamp(i);
-    if (!lastvalue.isValid() || lastvalue.secsTo(tmp) > 60) {
-      sessions.push_back(i-1);
-      // qDebug() << "session index" << i-1;
+  double lastvalue = NAN;
+  for (int i = 0; i < n; i++) {
+    double tmp = log.time.at(i);
+    if (std::isnan(lastvalue) || (!std::isnan(tmp) && (qint64)(tmp - lastvalue) / 1000 > 60)) {
+      sessions.push_back(i);
+      // qDebug() << "session index" << i;
     }
     lastvalue = tmp;
   }
-  sessions.push_back(n-1);
+  sessions.push_back(n);
 
   //now construct a list of sessions with their times
   //total time
   int noSesions = sessions.size()-1;
   QString label = QString("%1 ").arg(noSesions);
   label += tr(noSesions > 1 ? "sessions" : "session");
-  label += " <" + tr("time span") + generateDuration(getRecordTimeStamp(1), getRecordTimeStamp(n-1)) + ">";
+  label += " <" + tr("time span") + generateDuration(getRecordTimeStamp(0), getRecordTimeStamp(n-1)) + ">";
   ui->sessions_CB->addItem(label);
 
   // add individual sessions
   if (sessions.size() > 2) {
     for (int i = 1; i < sessions.size(); i++) {
-      QDateTime sessionStart = getRecordTimeStamp(sessions.at(i-1)+1);
-      QDateTime sessionEnd = getRecordTimeStamp(sessions.at(i));
+      QDateTime sessionStart = getRecordTimeStamp(sessions.at(i-1));
+      QDateTime sessionEnd = getRecordTimeStamp(sessions.at(i)-1);
       QString label = sessionStart.toString("HH:mm:ss") + " <" + tr("duration ") + generateDuration(sessionStart, sessionEnd) + ">";
       ui->sessions_CB->addItem(label, sessions.at(i-1));
       // qDebug() << "added label" << label << sessions.at(i-1);
@@ -800,13 +964,13 @@ void LogsDialog::sessionsCurrentIndexChanged(int index)
     if (index < ui->sessions_CB->count() - 1) {
       bottom = ui->sessions_CB->itemData(index + 1, Qt::UserRole).toInt();
     } else {
-      bottom = ui->logTable->rowCount();
+      bottom = logModel->rowCount();
     }
 
     QModelIndex topLeft = ui->logTable->model()->index(
       ui->sessions_CB->itemData(index, Qt::UserRole).toInt(), 0 , QModelIndex());
     QModelIndex bottomRight = ui->logTable->model()->index(
-      bottom - 1, ui->logTable->columnCount() - 1, QModelIndex());
+      bottom - 1, logModel->columnCount() - 1, QModelIndex());
 
     QItemSelection selection(topLeft, bottomRight);
     ui->logTable->selectionModel()->select(selection, QItemSelectionModel::Select);
@@ -845,7 +1009,7 @@ void LogsDialog::plotLogs()
     std::sort(selectedRows.begin(), selectedRows.end());
   } else {
     hasLogSelection = false;
-    rowCount = ui->logTable->rowCount();
+    rowCount = log.count();
   }
 
   plots.min_x = INVALID_MIN;
@@ -853,44 +1017,33 @@ void LogsDialog::plotLogs()
 
   foreach (QTableWidgetItem *plot, ui->FieldsTW->selectedItems()) {
     coords_t plotCoords;
-    int plotColumn = plot->row() + 2; // Date and Time first
+    const QVector<double> & values = log.columns.at(plot->row()); // Date and Time excluded
 
     plotCoords.min_y = INVALID_MIN;
     plotCoords.max_y = INVALID_MAX;
     plotCoords.yaxis = firstLeft;
     plotCoords.name = plot->text();
 
-    for (int row = 0; row < rowCount; row++) {
-      QTableWidgetItem *logValue;
-      double y;
-      double time;
-      QString time_str;
-
-      if (hasLogSelection) {
-        logValue = ui->logTable->item(selectedRows.at(row), plotColumn);
-        time_str = ui->logTable->item(selectedRows.at(row), 0)->text() +
-          QString(" ") + ui->logTable->item(selectedRows.at(row), 1)->text();
-      } else {
-        logValue = ui->logTable->item(row, plotColumn);
-        time_str = ui->logTable->item(row, 0)->text() + QString(" ") +
-          ui->logTable->item(row, 1)->text();
+    if (hasLogSelection) {
+      plotCoords.x.reserve(rowCount);
+      plotCoords.y.reserve(rowCount);
+      for (int row = 0; row < rowCount; row++) {
+        plotCoords.x.push_back(log.time.at(selectedRows.at(row)));
+        plotCoords.y.push_back(values.at(selectedRows.at(row)));
       }
+    } else {
+      // shared with the log columns, no copy
+      plotCoords.x = log.time;
+      plotCoords.y = values;
+    }
 
-      y = logValue->text().toDouble();
-      plotCoords.y.push_back(y);
+    for (int row = 0; row < rowCount; row++) {
+      double y = plotCoords.y.at(row);
+      double time = plotCoords.x.at(row);
 
       if (plotCoords.min_y > y) plotCoords.min_y = y;
       if (plotCoords.max_y < y) plotCoords.max_y = y;
 
-      if (time_str.contains('.')) {
-        time = QDateTime::fromString(time_str, "yyyy-MM-dd HH:mm:ss.zzz").toMSecsSinceEpoch();
-        time += time_str.mid(time_str.indexOf('.')).toDouble();
-      } else {
-        time = QDateTime::fromString(time_str, "yyyy-MM-dd HH:mm:ss").toMSecsSinceEpoch();
-      }
-
-      plotCoords.x.push_back(time);
-
       if(plots.min_x == INVALID_MIN)
         plots.min_x = time;
       else
@@ -987,6 +1140,7 @@ void LogsDialog::plotLogs()
   }
 
   removeAllGraphs();
+  graphsData = plots.coords;
 
   axisRect->axis(QCPAxis::atBottom)->setRange(plots.min_x, plots.max_x);
 
@@ -1060,14 +1214,13 @@ void LogsDialog::plotLogs()
         break;
     }
 
-    ui->customPlot->graph(i)->setData(plots.coords.at(i).x,
-      plots.coords.at(i).y);
     pen.setColor(colors.at(i % colors.size()));
     ui->customPlot->graph(i)->setPen(pen);
 
     if (!tracerMaxAlt && (plots.coords.at(i).name.endsWith("(m)") ||
         plots.coords.at(i).name.endsWith(" Alt") ||
         plots.coords.at(i).name.endsWith("(ft)"))) {
+      altitudeGraph = i;
       addMaxAltitudeMarker(plots.coords.at(i), ui->customPlot->graph(i));
       countNumberOfThrows(plots.coords.at(i), ui->customPlot->graph(i));
       addCursor(&cursorA, ui->customPlot->graph(i), Qt::blue);
@@ -1077,10 +1230,42 @@ void LogsDialog::plotLogs()
     }
   }
 
+  updateGraphsData();
+
   ui->customPlot->legend->setVisible(true);
   ui->customPlot->replot();
 }
 
+void LogsDialog::updateGraphsData()
+{
+  // QCustomPlot only gets as many points as there are pixels
+  // in the visible time range
+  QCPRange range = axisRect->axis(QCPAxis::atBottom)->range();
+  int threshold = std::max(axisRect->width(), 100);
+
+  for (int i = 0; i < ui->customPlot->graphCount() && i < graphsData.size(); i++) {
+    const coords_t & c = graphsData.at(i);
+
+    // keep one point outside on each side, so that lines reach the borders
+    int first = std::lower_bound(c.x.constBegin(), c.x.constEnd(), range.lower) - c.x.constBegin();
+    int last = std::upper_bound(c.x.constBegin(), c.x.constEnd(), range.upper) - c.x.constBegin();
+    first = std::max(first - 1, 0);
+    last = std::min(last + 1, (int)c.x.count());
+
+    QVector<double> x, y;
+    if (last > first) {
+      downsampleLttb(c.x.constData() + first, c.y.constData() + first, last - first, threshold, x, y);
+    }
+    ui->customPlot->graph(i)->setData(x, y, true);
+  }
+}
+
+void LogsDialog::xAxisChangeRange(QCPRange range)
+{
+  Q_UNUSED(range);
+  updateGraphsData();
+}
+
 void LogsDialog::yAxisChangeRanges(QCPRange range)
 {
   if (axisRect->axis(QCPAxis::atRight)->visible()) {
@@ -1140,15 +1325,14 @@ void LogsDialog::addMaxAltitudeMarker(const coords_t & c, QCPGraph * graph) {
   // qDebug() << "max alt: " << maxAlt << "@" << positionIndex;
 
   // add max altitude marker
+  // not attached to the graph, as its data is downsampled
   tracerMaxAlt = new QCPItemTracer(ui->customPlot);
-  tracerMaxAlt->setGraph(graph);
-  tracerMaxAlt->setInterpolating(true);
+  tracerMaxAlt->position->setAxes(graph->keyAxis(), graph->valueAxis());
   tracerMaxAlt->setStyle(QCPItemTracer::tsSquare);
   tracerMaxAlt->setPen(QPen(Qt::blue));
   tracerMaxAlt->setBrush(Qt::NoBrush);
   tracerMaxAlt->setSize(7);
-  tracerMaxAlt->setGraphKey(c.x.at(positionIndex));
-  tracerMaxAlt->updatePosition();
+  tracerMaxAlt->position->setCoords(c.x.at(positionIndex), c.y.at(positionIndex));
 }
 
 void LogsDialog::countNumberOfThrows(const coords_t & c, QCPGraph * graph)
@@ -1167,8 +1351,7 @@ void LogsDialog::countNumberOfThrows(const coords_t & c, QCPGraph * graph)
 
 void LogsDialog::addCursor(QCPItemTracer ** cursor, QCPGraph * graph, const QColor & color) {
   QCPItemTracer * c = new QCPItemTracer(ui->customPlot);
-  c->setGraph(graph);
-  c->setInterpolating(false);
+  c->position->setAxes(graph->keyAxis(), graph->valueAxis());
   c->setStyle(QCPItemTracer::tsCrosshair);
   QPen pen(color);
   pen.setStyle(Qt::DashLine);
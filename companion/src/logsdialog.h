@@ -32,6 +32,41 @@ namespace Ui {
   class LogsDialog;
 }
 
+// Log file contents, parsed once when the file is opened:
+//  - records are kept as raw CSV lines, for display and export
+//  - each field after Date and Time is also stored as a column of doubles,
+//    with the timestamps in their own column, for plotting
+struct LogData
+{
+  QStringList header;
+  QVector<QByteArray> records;
+  QVector<double> time;               // ms since epoch, NAN if invalid
+  QVector<QVector<double>> columns;   // header index - 2
+
+  void clear();
+  int count() const { return records.size(); }
+  QString field(int record, int index) const;
+  QStringList fields(int record) const;
+};
+
+class LogsTableModel : public QAbstractTableModel
+{
+  Q_OBJECT
+
+  public:
+    explicit LogsTableModel(const LogData & log, QObject * parent = nullptr);
+
+    int rowCount(const QModelIndex & parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex & parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex & index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    void reset();
+
+  private:
+    const LogData & log;
+};
+
 class LogsDialog : public QDialog
 {
   Q_OBJECT
@@ -82,9 +117,11 @@ private slots:
   void sessionsCurrentIndexChanged(int index);
   void mapsButtonClicked();
   void yAxisChangeRanges(QCPRange range);
+  void xAxisChangeRange(QCPRange range);
 
 private:
-  QList<QStringList> csvlog;
+  LogData log;
+  LogsTableModel *logModel;
   Ui::LogsDialog *ui;
   QCPAxisRect *axisRect;
   QCPLegend *rightLegend;
@@ -102,12 +139,17 @@ private:
   QCPItemTracer * cursorB;
   QCPItemStraightLine * cursorLine;
 
+  // full resolution data of the graphs, downsampled to the axis width
+  QVarLengthArray<coords_t> graphsData;
+  int altitudeGraph;
+
   bool cvsFileParse();
-  QList<QStringList> filterGePoints(const QList<QStringList> & input);
+  QList<QStringList> filterGePoints();
   void exportToGoogleEarth();
   QDateTime getRecordTimeStamp(int index);
   QString generateDuration(const QDateTime & start, const QDateTime & end);
   void setFlightSessions();
+  void updateGraphsData();
 
   void addMaxAltitudeMarker(const coords_t & c, QCPGraph * graph);
   void countNumberOfThrows(const coords_t & c, QCPGraph * graph);
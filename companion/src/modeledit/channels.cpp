@@ -245,7 +245,7 @@ void ChannelsPanel::nameEdited()
     int index = le->property("index").toInt();
     if (model->limitData[index].name != le->text()) {
       strcpy(model->limitData[index].name, le->text().toLatin1());
-      updateItemModels();
+      updateItemModels(index);
       emit modified();
     }
   }
@@ -470,3 +470,9 @@ void ChannelsPanel::updateItemModels()
   sharedItemModels->update(AbstractItemModel::IMUE_Channels);
   emit modified();
 }
+
+void ChannelsPanel::updateItemModels(const int index)
+{
+  sharedItemModels->update(AbstractItemModel::IMUE_Channels, index, index);
+  emit modified();
+}
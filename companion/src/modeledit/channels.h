@@ -110,5 +110,6 @@ class ChannelsPanel : public ModelPanel
     bool moveUpAllowed() const;
 
     void updateItemModels();
+    void updateItemModels(const int index);
     void connectItemModelEvents(const FilteredItemModel * itemModel);
 };
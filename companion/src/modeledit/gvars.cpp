@@ -392,7 +392,7 @@ void GlobalVariablesPanel::nameEditingFinished()
     if (ok) {
       memset(&model->gvarData[gidx].name, 0, sizeof(model->gvarData[gidx].name));
       strcpy(model->gvarData[gidx].name, lineedit->text().toLatin1());
-      updateItemModels();
+      updateItemModels(gidx);
       emit modified();
     }
   }
@@ -587,6 +587,11 @@ void GlobalVariablesPanel::updateItemModels()
   sharedItemModels->update(AbstractItemModel::IMUE_GVars);
 }
 
+void GlobalVariablesPanel::updateItemModels(const int index)
+{
+  sharedItemModels->update(AbstractItemModel::IMUE_GVars, index, index);
+}
+
 void GlobalVariablesPanel::useModeToggled(bool checked)
 {
   if (!lock) {
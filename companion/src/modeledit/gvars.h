@@ -99,4 +99,5 @@ class GlobalVariablesPanel : public ModelPanel
     void swapData(int index1, int index2);
     void updateLine(const int index);
     void updateItemModels();
+    void updateItemModels(const int index);
 };
@@ -203,7 +203,7 @@ void LogicalSwitchesPanel::onFunctionChanged()
     updateLine(i);
 
     if (oldFunc == LS_FN_OFF || newFunc == LS_FN_OFF)
-      updateItemModels();
+      updateItemModels(i);
 
     emit modified();
   }
@@ -516,7 +516,7 @@ void LogicalSwitchesPanel::cmPaste()
   if (hasClipboardData(&data)) {
     memcpy(&model->logicalSw[selectedIndex], data.constData(), sizeof(LogicalSwitchData));
     updateLine(selectedIndex);
-    updateItemModels();
+    updateItemModels(selectedIndex);
     emit modified();
   }
 }
@@ -671,6 +671,12 @@ void LogicalSwitchesPanel::updateItemModels()
   sharedItemModels->update(AbstractItemModel::IMUE_LogicalSwitches);
 }
 
+void LogicalSwitchesPanel::updateItemModels(const int index)
+{
+  lock = true;
+  sharedItemModels->update(AbstractItemModel::IMUE_LogicalSwitches, index, index);
+}
+
 void LogicalSwitchesPanel::connectItemModelEvents(const FilteredItemModel * itemModel)
 {
   connect(itemModel, &FilteredItemModel::aboutToBeUpdated, this, &LogicalSwitchesPanel::onItemModelAboutToBeUpdated);
@@ -92,6 +92,7 @@ class LogicalSwitchesPanel : public ModelPanel
     bool moveUpAllowed() const;
     int modelsUpdateCnt;
     void updateItemModels();
+    void updateItemModels(const int index);
     void connectItemModelEvents(const FilteredItemModel * itemModel);
 };
 
@@ -49,9 +49,7 @@ RadioOutputsWidget::RadioOutputsWidget(SimulatorInterface * simulator, Firmware
   connect(ui->channelsScroll->horizontalScrollBar(), &QScrollBar::sliderMoved, ui->mixersScroll->horizontalScrollBar(), &QScrollBar::setValue);
   connect(ui->mixersScroll->horizontalScrollBar(), &QScrollBar::sliderMoved, ui->channelsScroll->horizontalScrollBar(), &QScrollBar::setValue);
 
-  connect(m_simulator, &SimulatorInterface::channelOutValueChange, this, &RadioOutputsWidget::onChannelOutValueChange);
-  connect(m_simulator, &SimulatorInterface::channelMixValueChange, this, &RadioOutputsWidget::onChannelMixValueChange);
-  connect(m_simulator, &SimulatorInterface::virtualSwValueChange, this, &RadioOutputsWidget::onVirtSwValueChange);
+  connect(m_simulator, &SimulatorInterface::outputsChanged, this, &RadioOutputsWidget::onOutputsChanged);
   connect(m_simulator, &SimulatorInterface::gVarValueChange, this, &RadioOutputsWidget::onGVarValueChange);
   connect(m_simulator, &SimulatorInterface::phaseChanged, this, &RadioOutputsWidget::onPhaseChanged);
 }
@@ -81,6 +79,12 @@ void RadioOutputsWidget::start()
   setupChannelsDisplay(true);
   setupGVarsDisplay();
   setupLsDisplay();
+
+  // fill the new displays with the last snapshot
+  if (m_outputsValid) {
+    m_outputsValid = false;
+    onOutputsChanged(m_outputs);
+  }
 }
 
 //void RadioOutputsWidget::stop()
@@ -301,6 +305,28 @@ QWidget * RadioOutputsWidget::createLogicalSwitch(QWidget * parent, int switchNo
   return swtch;
 }
 
+void RadioOutputsWidget::onOutputsChanged(const SimulatorInterface::TxOutputs & outputs)
+{
+  // only update the widgets of changed values
+  bool all = !m_outputsValid || outputs.chansLimit != m_outputs.chansLimit ||
+             outputs.mixesLimit != m_outputs.mixesLimit;
+
+  for (int i = 0; i < CPN_MAX_CHNOUT; i++) {
+    if (all || outputs.chans[i] != m_outputs.chans[i])
+      onChannelOutValueChange(i, outputs.chans[i], outputs.chansLimit);
+    if (all || outputs.ex_chans[i] != m_outputs.ex_chans[i])
+      onChannelMixValueChange(i, outputs.ex_chans[i], outputs.mixesLimit);
+  }
+
+  for (int i = 0; i < CPN_MAX_LOGICAL_SWITCHES; i++) {
+    if (all || outputs.vsw[i] != m_outputs.vsw[i])
+      onVirtSwValueChange(i, outputs.vsw[i]);
+  }
+
+  m_outputs = outputs;
+  m_outputsValid = true;
+}
+
 void RadioOutputsWidget::onChannelOutValueChange(quint8 index, qint32 value, qint32 limit)
 {
   if (m_channelsMap.contains(index)) {
@@ -128,6 +128,8 @@ class SimulatorInterface : public QObject
 
       int16_t chans[CPN_MAX_CHNOUT];       // final channel outputs
       int16_t ex_chans[CPN_MAX_CHNOUT];    // raw mix outputs
+      qint32 chansLimit;                   // display limit of chans
+      qint32 mixesLimit;                   // display limit of ex_chans
       qint32 gvars[CPN_MAX_FLIGHT_MODES][CPN_MAX_GVARS];
       int trims[CPN_MAX_TRIMS];            // Board::TrimAxes enum
       bool vsw[CPN_MAX_LOGICAL_SWITCHES];  // virtual/logic switches
@@ -180,13 +182,10 @@ class SimulatorInterface : public QObject
     void runtimeError(const QString & error);
     void lcdChange(bool backlightEnable);
     void phaseChanged(qint8 phase, const QString & name);
-    void channelOutValueChange(quint8 index, qint32 value, qint32 limit);
-    void channelMixValueChange(quint8 index, qint32 value, qint32 limit);
-    void virtualSwValueChange(quint8 index, qint32 value);
-    void trimValueChange(quint8 index, qint32 value);
+    // one snapshot per cycle when any channel, mix, logical switch or trim changed
+    void outputsChanged(const SimulatorInterface::TxOutputs & outputs);
     void trimRangeChange(quint8 index, qint32 min, qint16 max);
     void gVarValueChange(quint8 index, qint32 value);
-    void outputValueChange(int type, quint8 index, qint32 value);
     void auxSerialSendData(const quint8 port_num, const QByteArray & data);
     void auxSerialSetEncoding(const quint8 port_num, const quint8 encoding);
     void auxSerialSetBaudrate(const quint8 port_num, const quint32 baudrate);
@@ -196,6 +195,8 @@ class SimulatorInterface : public QObject
     void fsColorChange(quint8 index, qint32 color);
 };
 
+Q_DECLARE_METATYPE(SimulatorInterface::TxOutputs)
+
 class SimulatorFactory {
 
   public:
@@ -90,8 +90,8 @@ SimulatorWidget::SimulatorWidget(QWidget * parent, SimulatorInterface * simulato
   connect(vJoyRight, &VirtualJoystickWidget::valueChange, this, &SimulatorWidget::onRadioWidgetValueChange);
   connect(this, &SimulatorWidget::stickModeChange, vJoyLeft, &VirtualJoystickWidget::loadDefaultsForMode);
   connect(this, &SimulatorWidget::stickModeChange, vJoyRight, &VirtualJoystickWidget::loadDefaultsForMode);
-  connect(simulator, &SimulatorInterface::trimValueChange, vJoyLeft, &VirtualJoystickWidget::setTrimValue);
-  connect(simulator, &SimulatorInterface::trimValueChange, vJoyRight, &VirtualJoystickWidget::setTrimValue);
+  connect(this, &SimulatorWidget::trimValueChange, vJoyLeft, &VirtualJoystickWidget::setTrimValue);
+  connect(this, &SimulatorWidget::trimValueChange, vJoyRight, &VirtualJoystickWidget::setTrimValue);
   connect(simulator, &SimulatorInterface::trimRangeChange, vJoyLeft, &VirtualJoystickWidget::setTrimRange);
   connect(simulator, &SimulatorInterface::trimRangeChange, vJoyRight, &VirtualJoystickWidget::setTrimRange);
 
@@ -104,6 +104,7 @@ SimulatorWidget::SimulatorWidget(QWidget * parent, SimulatorInterface * simulato
 
   connect(simulator, &SimulatorInterface::started, this, &SimulatorWidget::onSimulatorStarted);
   connect(simulator, &SimulatorInterface::heartbeat, this, &SimulatorWidget::onSimulatorHeartbeat);
+  connect(simulator, &SimulatorInterface::outputsChanged, this, &SimulatorWidget::onSimulatorOutputsChanged);
   connect(simulator, &SimulatorInterface::runtimeError, this, &SimulatorWidget::onSimulatorError);
   connect(simulator, &SimulatorInterface::phaseChanged, this, &SimulatorWidget::onPhaseChanged);
 
@@ -512,6 +513,9 @@ void SimulatorWidget::setupRadioWidgets()
   const int stickTrims = Boards::getCapability(m_board, Board::Air) ? ttlSticks : 0;
   const int extraTrims = Boards::getCapability(m_board, Board::NumTrims) - stickTrims;
 
+  // new trim widgets get all values with the next outputs snapshot
+  m_trimsValid = false;
+
   // First clear out any existing widgets.
   foreach (RadioWidget * rw, m_radioWidgets) {
     switch(rw->getType()) {
@@ -607,7 +611,7 @@ void SimulatorWidget::setupRadioWidgets()
     ui->VCGridLayout->addWidget(tw, 0, tc, 1, 1);
     tc++;
 
-    connect(simulator, &SimulatorInterface::trimValueChange, tw, &RadioTrimWidget::setTrimValue);
+    connect(this, &SimulatorWidget::trimValueChange, tw, &RadioTrimWidget::setTrimValue);
     connect(simulator, &SimulatorInterface::trimRangeChange, tw, &RadioTrimWidget::setTrimRangeQual);
     m_radioWidgets.append(tw);
   }
@@ -751,6 +755,17 @@ void SimulatorWidget::onSimulatorHeartbeat(qint32 loops, qint64 timestamp)
 #endif
 }
 
+void SimulatorWidget::onSimulatorOutputsChanged(const SimulatorInterface::TxOutputs & outputs)
+{
+  for (int i = 0; i < CPN_MAX_TRIMS; i++) {
+    if (!m_trimsValid || outputs.trims[i] != m_trims[i]) {
+      m_trims[i] = outputs.trims[i];
+      emit trimValueChange(i, m_trims[i]);
+    }
+  }
+  m_trimsValid = true;
+}
+
 void SimulatorWidget::onSimulatorError(const QString & error)
 {
   QMessageBox::critical(this, windowName, tr("Radio firmware error: %1").arg(error.isEmpty() ? "Unknown reason" : error));
@@ -100,6 +100,7 @@ class SimulatorWidget : public QWidget
     void simulatorSdPathChange(const QString & sdPath, const QString & dataPath);
     void simulatorVolumeGainChange(const int gain);
     void settingsBatteryChanged(const int batMin, const int batMax, const unsigned int batWarn);
+    void trimValueChange(quint8 index, qint32 value);
 
   private slots:
     virtual void mousePressEvent(QMouseEvent *event);
@@ -110,6 +111,7 @@ class SimulatorWidget : public QWidget
     void onSimulatorStarted();
     void onSimulatorStopped();
     void onSimulatorHeartbeat(qint32 loops, qint64 timestamp);
+    void onSimulatorOutputsChanged(const SimulatorInterface::TxOutputs & outputs);
     void onPhaseChanged(qint32 phase, const QString & name);
     void onSimulatorError(const QString & error);
     void onRadioWidgetValueChange(const RadioWidget::RadioWidgetType type, int index, int value);
@@ -138,6 +140,8 @@ class SimulatorWidget : public QWidget
     VirtualJoystickWidget * vJoyLeft = nullptr;
     VirtualJoystickWidget * vJoyRight = nullptr;
     QVector<RadioWidget *> m_radioWidgets;
+    int m_trims[CPN_MAX_TRIMS];
+    bool m_trimsValid = false;
 
     QString sdCardPath;
     QString radioDataPath;
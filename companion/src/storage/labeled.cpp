@@ -22,8 +22,13 @@
 #include "labeled.h"
 #include "firmwares/opentx/opentxinterface.h"
 #include "firmwares/edgetx/edgetxinterface.h"
+#include "helpers.h"
+#include "version.h"
+
+#include <QtConcurrent>
 
 #include <regex>
+#include <vector>
 
 StorageType LabelsStorageFormat::probeFormat()
 {
@@ -121,16 +126,35 @@ bool LabelsStorageFormat::load(RadioData & radioData)
   if (hasLabels)
     radioData.models.resize(modelFiles.size());
 
+  // Models are parsed in 3 steps:
+  //  - files are extracted in the calling thread (zip reader is not reentrant)
+  //  - YAML parsing is spread over the global thread pool, each job
+  //    writing only its own slot in radioData.models
+  //  - results are merged in model order, so that errors are reported
+  //    as before
+  struct ModelLoadJob {
+    int modelIdx;
+    QString filename;
+    QByteArray buffer;
+    QString error;
+    bool deferred;
+  };
+
+  std::vector<ModelLoadJob> jobs;
+  jobs.reserve(modelFiles.size());
+  std::vector<bool> slotTaken(radioData.models.size(), false);
+
   for (const auto& mc : modelFiles) {
     qDebug() << "Filename: " << mc.filename.c_str();
 
     if (!hasLabels) {
       if (mc.modelIdx >= 0 && mc.modelIdx < (int)radioData.models.size()) {
         modelIdx = mc.modelIdx;
-        if (!radioData.models[modelIdx].isEmpty()) {
+        if (!radioData.models[modelIdx].isEmpty() || slotTaken[modelIdx]) {
           qDebug() << QString("Warning: file %1 skipped as slot %2 already used").arg(mc.filename.c_str()).arg(mc.modelIdx + 1);
           continue;
         }
+        slotTaken[modelIdx] = true;
       }
       else {
         qDebug() << QString("Warning: file %1 skipped as slot %2 not available").arg(mc.filename.c_str()).arg(mc.modelIdx + 1);
@@ -138,39 +162,64 @@ bool LabelsStorageFormat::load(RadioData & radioData)
       }
     }
 
-    QByteArray modelBuffer;
     QString filename = "MODELS/" + QString::fromStdString(mc.filename);
-    if (!loadFile(modelBuffer, filename)) {
+    ModelLoadJob job = { modelIdx, filename, QByteArray(), QString(), false };
+    if (!loadFile(job.buffer, filename)) {
       setError(tr("Cannot extract ") + filename);
       return false;
     }
 
-    // Please note:
-    //  ModelData() use memset to clear everything to 0
-    //
-    auto& model = radioData.models[modelIdx];
+    jobs.push_back(job);
+    modelIdx++;
+  }
+
+  // Please note:
+  //  ModelData() use memset to clear everything to 0
+  //
+  QtConcurrent::blockingMap(jobs, [&radioData](ModelLoadJob& job) {
+    auto& model = radioData.models[job.modelIdx];
 
     try {
-      if (!loadModelFromYaml(model,modelBuffer)) {
-        setError(tr("Cannot load ") + filename);
-        return false;
-      }
+      if (!loadModelFromYaml(model, job.buffer))
+        job.error = tr("Cannot load ") + job.filename;
     } catch(const std::runtime_error& e) {
-      setError(tr("Cannot load ") + filename + ":\n" + QString(e.what()));
+      // newer settings version needs a confirmation in the UI thread
+      if (SemanticVersion().isValid(model.semver) &&
+          SemanticVersion(QString(model.semver)) > SemanticVersion(VERSION))
+        job.deferred = true;
+      else
+        job.error = tr("Cannot load ") + job.filename + ":\n" + QString(e.what());
+    }
+  });
+
+  for (auto& job : jobs) {
+    auto& model = radioData.models[job.modelIdx];
+
+    if (job.deferred) {
+      model.clear();
+      try {
+        if (!loadModelFromYaml(model, job.buffer))
+          job.error = tr("Cannot load ") + job.filename;
+      } catch(const std::runtime_error& e) {
+        job.error = tr("Cannot load ") + job.filename + ":\n" + QString(e.what());
+      }
+    }
+
+    if (!job.error.isEmpty()) {
+      setError(job.error);
       return false;
     }
 
     if (!loadChecklist(model))
       return false;
 
-    model.modelIndex = modelIdx;
-    strncpy(model.filename, mc.filename.c_str(), sizeof(model.filename)-1);
+    model.modelIndex = job.modelIdx;
+    strncpy(model.filename, qPrintable(job.filename.mid(strlen("MODELS/"))), sizeof(model.filename)-1);
 
     if (hasLabels && !strncmp(radioData.generalSettings.currModelFilename, model.filename, sizeof(model.filename)))
-      radioData.generalSettings.currModelIndex = modelIdx;
+      radioData.generalSettings.currModelIndex = job.modelIdx;
 
     model.used = true;
-    modelIdx++;
   }
 
   // Add the labels in the models
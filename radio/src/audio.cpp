@@ -700,8 +700,16 @@ bool AudioQueue::isPlaying(uint8_t id)
          fragmentsFifo.hasPromptId(id);
 }
 
+#if defined(SIMU)
+void (*simuAudioTraceCb)(const char * filename, uint16_t freq, uint16_t len) = nullptr;
+#endif
+
 void AudioQueue::playTone(uint16_t freq, uint16_t len, uint16_t pause, uint8_t flags, int8_t freqIncr, int8_t fragmentVolume)
 {
+#if defined(SIMU)
+  if (simuAudioTraceCb) simuAudioTraceCb(nullptr, freq, len);
+#endif
+
   _audio_lock();
 
   freq = limit<uint16_t>(BEEP_MIN_FREQ, freq, BEEP_MAX_FREQ);
@@ -735,6 +743,7 @@ void AudioQueue::playFile(const char * filename, uint8_t flags, uint8_t id, int8
   if (strlen(filename) > AUDIO_FILENAME_MAXLEN) {
     TRACE("file name too long! maximum length is %d characters", AUDIO_FILENAME_MAXLEN);
   }
+  if (simuAudioTraceCb) simuAudioTraceCb(filename, 0, 0);
 #endif
 
   if (!sdMounted())
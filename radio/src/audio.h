@@ -456,6 +456,11 @@ class AudioQueue {
 extern uint8_t currentSpeakerVolume;
 extern AudioQueue audioQueue;
 
+#if defined(SIMU)
+// Called for each tone (filename == nullptr) or file played
+extern void (*simuAudioTraceCb)(const char * filename, uint16_t freq, uint16_t len);
+#endif
+
 enum {
   // IDs for special functions [0:64]
   // IDs for global functions [64:128]
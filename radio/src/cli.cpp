@@ -43,6 +43,7 @@
 
 #include "tasks.h"
 #include "tasks/mixer_task.h"
+#include "latency_trace.h"
 
 #include "cli.h"
 
@@ -1617,6 +1618,27 @@ int cliShowJitter(const char ** argv)
 }
 #endif
 
+#if defined(LATENCY_TRACE)
+static void cliLatencyOutput(const char * line)
+{
+  cliSerialPrint("%s", line);
+}
+
+int cliLatency(const char ** argv)
+{
+  if (!strcmp(argv[1], "reset")) {
+    latencyTraceReset();
+  }
+  else if (argv[1][0] == '\0') {
+    latencyTraceReport(cliLatencyOutput);
+  }
+  else {
+    cliSerialPrint("%s: Invalid argument \"%s\"", argv[0], argv[1]);
+  }
+  return 0;
+}
+#endif
+
 #if defined(INTERNAL_GPS)
 int cliGps(const char ** argv)
 {
@@ -1804,6 +1826,9 @@ const CliCommand cliCommands[] = {
 #if defined(JITTER_MEASURE)
   { "jitter", cliShowJitter, "" },
 #endif
+#if defined(LATENCY_TRACE)
+  { "latency", cliLatency, "[reset]" },
+#endif
 #if defined(INTERNAL_GPS)
   { "gps", cliGps, "<baudrate>|$<command>|trace" },
 #endif
@@ -22,7 +22,7 @@
 #include "crc.h"
 
 // CRC16 implementation according to CCITT standards
-static const unsigned short crc16tab_1021[256] = {
+static constexpr unsigned short crc16tab_1021[256] = {
   0x0000,0x1021,0x2042,0x3063,0x4084,0x50a5,0x60c6,0x70e7,
   0x8108,0x9129,0xa14a,0xb16b,0xc18c,0xd1ad,0xe1ce,0xf1ef,
   0x1231,0x0210,0x3273,0x2252,0x52b5,0x4294,0x72f7,0x62d6,
@@ -57,7 +57,7 @@ static const unsigned short crc16tab_1021[256] = {
   0x6e17,0x7e36,0x4e55,0x5e74,0x2e93,0x3eb2,0x0ed1,0x1ef0
 };
 
-static const unsigned short crc16tab_1189[256] = {
+static constexpr unsigned short crc16tab_1189[256] = {
   0x0000,0x1189,0x2312,0x329b,0x4624,0x57ad,0x6536,0x74bf,
   0x8c48,0x9dc1,0xaf5a,0xbed3,0xca6c,0xdbe5,0xe97e,0xf8f7,
   0x1081,0x0108,0x3393,0x221a,0x56a5,0x472c,0x75b7,0x643e,
@@ -97,10 +97,46 @@ const unsigned short * const crc16tab[] = {
   crc16tab_1189
 };
 
+#if !defined(BOOT)
+// Slice-by-4: 3 more tables derived from the byte-wise one allow
+// processing 4 bytes per iteration. The tables are computed at compile
+// time and stored in flash (3 KB), so they are left out of the bootloader.
+#define CRC16_SLICE_BY_4
+
+struct Crc16Slices {
+  unsigned short tab[3][256];
+
+  constexpr Crc16Slices(const unsigned short * base) : tab()
+  {
+    for (int i = 0; i < 256; i++) {
+      unsigned short crc = base[i];
+      for (int k = 0; k < 3; k++) {
+        crc = (unsigned short)(crc << 8) ^ base[crc >> 8];
+        tab[k][i] = crc;
+      }
+    }
+  }
+};
+
+static constexpr Crc16Slices crc16slices[] = {
+  Crc16Slices(crc16tab_1021),
+  Crc16Slices(crc16tab_1189)
+};
+#endif
+
 uint16_t crc16(uint8_t index, const uint8_t * buf, uint32_t len, uint16_t start)
 {
   uint16_t crc = start;
   const unsigned short * tab = crc16tab[index];
+
+#if defined(CRC16_SLICE_BY_4)
+  const auto & slices = crc16slices[index].tab;
+  for (; len >= 4; len -= 4, buf += 4) {
+    crc = slices[2][buf[0] ^ (crc >> 8)] ^ slices[1][buf[1] ^ (crc & 0xFF)] ^
+          slices[0][buf[2]] ^ tab[buf[3]];
+  }
+#endif
+
   for (uint32_t i = 0; i < len; i++) {
     crc = (crc << 8) ^ tab[((crc >> 8) ^ *buf++) & 0x00FF];
   }
@@ -29,7 +29,56 @@ enum {
 };
 
 extern const unsigned short * const crc16tab[2];
+extern const unsigned char crc8tab[256];
+extern const unsigned char crc8tab_BA[256];
 
 uint8_t crc8(const uint8_t * ptr, uint32_t len);
 uint8_t crc8_BA(const uint8_t * ptr, uint32_t len);
 uint16_t crc16(uint8_t index, const uint8_t * buf, uint32_t len, uint16_t start = 0);
+
+// Incremental CRC16, for data processed in chunks
+// (file blocks, frames built byte after byte, ...)
+class Crc16
+{
+ public:
+  explicit Crc16(uint8_t index, uint16_t start = 0) : index(index), crc(start) {}
+
+  void update(const uint8_t * buf, uint32_t len)
+  {
+    crc = crc16(index, buf, len, crc);
+  }
+
+  void update(uint8_t byte)
+  {
+    crc = (crc << 8) ^ crc16tab[index][((crc >> 8) ^ byte) & 0xFF];
+  }
+
+  uint16_t get() const { return crc; }
+
+ protected:
+  uint8_t index;
+  uint16_t crc;
+};
+
+// Incremental CRC8 (polynom 0xD5 by default, crc8tab_BA for 0xBA)
+class Crc8
+{
+ public:
+  explicit Crc8(const unsigned char * tab = crc8tab) : tab(tab) {}
+
+  void update(const uint8_t * buf, uint32_t len)
+  {
+    while (len--) update(*buf++);
+  }
+
+  void update(uint8_t byte)
+  {
+    crc = tab[crc ^ byte];
+  }
+
+  uint8_t get() const { return crc; }
+
+ protected:
+  const unsigned char * tab;
+  uint8_t crc = 0;
+};
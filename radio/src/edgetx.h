@@ -161,6 +161,17 @@ struct CustomFunctionsContext {
   MASK_CFN_TYPE  activeSwitches;
   tmr10ms_t lastFunctionTime[MAX_SPECIAL_FUNCTIONS];
 
+  // Compiled functions table (rebuilt by evalFunctions() when invalid):
+  // configured slots in evaluation order, each referencing one of the
+  // distinct trigger switches (0xFF when the function is disabled)
+  bool compiled;
+  uint8_t entriesCount;
+  uint8_t triggersCount;
+  uint8_t entries[MAX_SPECIAL_FUNCTIONS];
+  uint8_t entryTrigger[MAX_SPECIAL_FUNCTIONS];
+  swsrc_t triggerSwitch[MAX_SPECIAL_FUNCTIONS];
+  uint8_t triggerFlags[MAX_SPECIAL_FUNCTIONS];
+
   inline bool isFunctionActive(uint8_t func)
   {
     return activeFunctions & ((MASK_FUNC_TYPE)1 << func);
@@ -170,6 +181,11 @@ struct CustomFunctionsContext {
   {
     memclear(this, sizeof(*this));
   }
+
+  void invalidate()
+  {
+    compiled = false;
+  }
 };
 
 #include "strhelpers.h"
@@ -453,6 +469,11 @@ inline void customFunctionsReset()
   globalFunctionsContext.reset();
   modelFunctionsContext.reset();
 }
+inline void customFunctionsInvalidate()
+{
+  globalFunctionsContext.invalidate();
+  modelFunctionsContext.invalidate();
+}
 
 const char* funcGetLabel(uint8_t func);
 uint8_t getFuncSortIdx(uint8_t func);
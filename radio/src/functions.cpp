@@ -146,6 +146,50 @@ bool isRepeatDelayElapsed(const CustomFunctionData * functions, CustomFunctionsC
   }
 }
 
+#define CFN_TRIGGER_DISABLED 0xFF
+
+static void compileFunctions(const CustomFunctionData * functions, CustomFunctionsContext & functionsContext)
+{
+  functionsContext.entriesCount = 0;
+  functionsContext.triggersCount = 0;
+
+  for (uint8_t i=0; i<MAX_SPECIAL_FUNCTIONS; i++) {
+    const CustomFunctionData * cfn = &functions[i];
+    swsrc_t swtch = CFN_SWITCH(cfn);
+    if (!swtch)
+      continue;
+
+    // disabled functions are kept, to run their "inactive" part
+    uint8_t trigger = CFN_TRIGGER_DISABLED;
+    if (CFN_ACTIVE(cfn)) {
+      uint8_t flags = IS_PLAY_FUNC(CFN_FUNC(cfn)) ? GETSWITCH_MIDPOS_DELAY : 0;
+      for (trigger = 0; trigger < functionsContext.triggersCount; trigger++) {
+        if (functionsContext.triggerSwitch[trigger] == swtch &&
+            functionsContext.triggerFlags[trigger] == flags)
+          break;
+      }
+      if (trigger == functionsContext.triggersCount) {
+        functionsContext.triggerSwitch[trigger] = swtch;
+        functionsContext.triggerFlags[trigger] = flags;
+        functionsContext.triggersCount++;
+      }
+    }
+
+    uint8_t entry = functionsContext.entriesCount++;
+    functionsContext.entries[entry] = i;
+    functionsContext.entryTrigger[entry] = trigger;
+  }
+
+  functionsContext.compiled = true;
+}
+
+#if defined(OVERRIDE_CHANNEL_FUNCTION)
+// Channels overridden by the last evaluation. Like safetyCh[], it is shared
+// by radio and model functions. All channels need a reset at startup.
+static_assert(MAX_OUTPUT_CHANNELS <= 32, "overriddenChannels is too small");
+static uint32_t overriddenChannels = (uint32_t)-1;
+#endif
+
 #define VOLUME_HYSTERESIS 10            // how much must a input value change to actually be considered for new volume setting
 getvalue_t requiredSpeakerVolumeRawLast = 1024 + 1; //initial value must be outside normal range
 
@@ -161,8 +205,10 @@ void evalFunctions(CustomFunctionData * functions, CustomFunctionsContext & func
   #define PLAY_INDEX   (i+playFirstIndex)
 
 #if defined(OVERRIDE_CHANNEL_FUNCTION)
-  for (uint8_t i=0; i<MAX_OUTPUT_CHANNELS; i++) {
-    safetyCh[i] = OVERRIDE_CHANNEL_UNDEFINED;
+  for (uint8_t i=0; overriddenChannels; i++) {
+    if (overriddenChannels & 1)
+      safetyCh[i] = OVERRIDE_CHANNEL_UNDEFINED;
+    overriddenChannels >>= 1;
   }
 #endif
 
@@ -176,326 +222,335 @@ void evalFunctions(CustomFunctionData * functions, CustomFunctionsContext & func
   bool videoEnabled = false;
 #endif
 
-  for (uint8_t i=0; i<MAX_SPECIAL_FUNCTIONS; i++) {
+  if (!functionsContext.compiled)
+    compileFunctions(functions, functionsContext);
+
+  // each distinct trigger switch is evaluated only once
+  MASK_CFN_TYPE triggers = 0;
+  for (uint8_t t=0; t<functionsContext.triggersCount; t++) {
+    if (getSwitch(functionsContext.triggerSwitch[t], functionsContext.triggerFlags[t]))
+      triggers |= ((MASK_CFN_TYPE)1 << t);
+  }
+
+  for (uint8_t e=0; e<functionsContext.entriesCount; e++) {
+    uint8_t i = functionsContext.entries[e];
     CustomFunctionData * cfn = &functions[i];
-    swsrc_t swtch = CFN_SWITCH(cfn);
-    if (swtch) {
-      MASK_CFN_TYPE switch_mask = ((MASK_CFN_TYPE)1 << i);
+    MASK_CFN_TYPE switch_mask = ((MASK_CFN_TYPE)1 << i);
 
-      bool active = getSwitch(swtch, IS_PLAY_FUNC(CFN_FUNC(cfn)) ? GETSWITCH_MIDPOS_DELAY : 0);
-      if (CFN_ACTIVE(cfn) == 0)
-        active = false;
+    uint8_t trigger = functionsContext.entryTrigger[e];
+    bool active = trigger != CFN_TRIGGER_DISABLED &&
+                  (triggers & ((MASK_CFN_TYPE)1 << trigger));
 
-      if (active) {
-        switch (CFN_FUNC(cfn)) {
+    if (active) {
+      switch (CFN_FUNC(cfn)) {
 #if defined(OVERRIDE_CHANNEL_FUNCTION)
-          case FUNC_OVERRIDE_CHANNEL:
-            safetyCh[CFN_CH_INDEX(cfn)] = CFN_PARAM(cfn);
-            break;
-#endif
+        case FUNC_OVERRIDE_CHANNEL:
+          safetyCh[CFN_CH_INDEX(cfn)] = CFN_PARAM(cfn);
+          overriddenChannels |= (1u << CFN_CH_INDEX(cfn));
+          break;
+#endif
+
+        case FUNC_TRAINER: {
+          uint8_t param = CFN_CH_INDEX(cfn);
+          if (param == 0)
+            newActiveFunctions |= 0x0F;
+          else if (param <= MAX_STICKS)
+            newActiveFunctions |= (1 << (param - 1));
+          else if (param == MAX_STICKS + 1)
+            newActiveFunctions |= (1u << FUNCTION_TRAINER_CHANNELS);
+          break;
+        }
 
-          case FUNC_TRAINER: {
-            uint8_t param = CFN_CH_INDEX(cfn);
-            if (param == 0)
-              newActiveFunctions |= 0x0F;
-            else if (param <= MAX_STICKS)
-              newActiveFunctions |= (1 << (param - 1));
-            else if (param == MAX_STICKS + 1)
-              newActiveFunctions |= (1u << FUNCTION_TRAINER_CHANNELS);
-            break;
+        case FUNC_INSTANT_TRIM:
+          newActiveFunctions |= (1u << FUNCTION_INSTANT_TRIM);
+          if (!isFunctionActive(FUNCTION_INSTANT_TRIM)) {
+            if (IS_INSTANT_TRIM_ALLOWED()) {
+              instantTrim();
+            }
           }
-
-          case FUNC_INSTANT_TRIM:
-            newActiveFunctions |= (1u << FUNCTION_INSTANT_TRIM);
-            if (!isFunctionActive(FUNCTION_INSTANT_TRIM)) {
-              if (IS_INSTANT_TRIM_ALLOWED()) {
-                instantTrim();
+          break;
+
+        case FUNC_RESET:
+          switch (CFN_PARAM(cfn)) {
+            case FUNC_RESET_TIMER1:
+            case FUNC_RESET_TIMER2:
+            case FUNC_RESET_TIMER3:
+              timerReset(CFN_PARAM(cfn));
+              break;
+            case FUNC_RESET_FLIGHT:
+              if (!(functionsContext.activeSwitches & switch_mask)) {
+                mainRequestFlags |=
+                    (1 << REQUEST_FLIGHT_RESET);  // on systems with threads
+                                                  // flightReset() must not be
+                                                  // called from the mixers
+                                                  // thread!
               }
-            }
-            break;
+              break;
+            case FUNC_RESET_TELEMETRY:
+              telemetryReset();
+              break;
 
-          case FUNC_RESET:
-            switch (CFN_PARAM(cfn)) {
-              case FUNC_RESET_TIMER1:
-              case FUNC_RESET_TIMER2:
-              case FUNC_RESET_TIMER3:
-                timerReset(CFN_PARAM(cfn));
-                break;
-              case FUNC_RESET_FLIGHT:
-                if (!(functionsContext.activeSwitches & switch_mask)) {
-                  mainRequestFlags |=
-                      (1 << REQUEST_FLIGHT_RESET);  // on systems with threads
-                                                    // flightReset() must not be
-                                                    // called from the mixers
-                                                    // thread!
-                }
-                break;
-              case FUNC_RESET_TELEMETRY:
-                telemetryReset();
-                break;
-
-              case FUNC_RESET_TRIMS: {
-                for (uint8_t i = 0; i < keysGetMaxTrims(); i++) {
-                  setTrimValue(mixerCurrentFlightMode, i, 0);
-                }
-                break;
+            case FUNC_RESET_TRIMS: {
+              for (uint8_t i = 0; i < keysGetMaxTrims(); i++) {
+                setTrimValue(mixerCurrentFlightMode, i, 0);
               }
+              break;
             }
-            if (CFN_PARAM(cfn) >= FUNC_RESET_PARAM_FIRST_TELEM) {
-              uint8_t item = CFN_PARAM(cfn) - FUNC_RESET_PARAM_FIRST_TELEM;
-              if (item < MAX_TELEMETRY_SENSORS) {
-                telemetryItems[item].clear();
-              }
+          }
+          if (CFN_PARAM(cfn) >= FUNC_RESET_PARAM_FIRST_TELEM) {
+            uint8_t item = CFN_PARAM(cfn) - FUNC_RESET_PARAM_FIRST_TELEM;
+            if (item < MAX_TELEMETRY_SENSORS) {
+              telemetryItems[item].clear();
             }
-            break;
+          }
+          break;
 
-          case FUNC_SET_TIMER:
-            timerSet(CFN_TIMER_INDEX(cfn), CFN_PARAM(cfn));
-            break;
+        case FUNC_SET_TIMER:
+          timerSet(CFN_TIMER_INDEX(cfn), CFN_PARAM(cfn));
+          break;
 
-          case FUNC_SET_FAILSAFE:
-            setCustomFailsafe(CFN_PARAM(cfn));
-            break;
+        case FUNC_SET_FAILSAFE:
+          setCustomFailsafe(CFN_PARAM(cfn));
+          break;
 
 #if defined(DANGEROUS_MODULE_FUNCTIONS)
-          case FUNC_RANGECHECK:
-          case FUNC_BIND: {
-            unsigned int moduleIndex = CFN_PARAM(cfn);
-            if (moduleIndex < NUM_MODULES) {
-              moduleState[moduleIndex].mode =
-                  1 + CFN_FUNC(cfn) - FUNC_RANGECHECK;
-            }
-            break;
+        case FUNC_RANGECHECK:
+        case FUNC_BIND: {
+          unsigned int moduleIndex = CFN_PARAM(cfn);
+          if (moduleIndex < NUM_MODULES) {
+            moduleState[moduleIndex].mode =
+                1 + CFN_FUNC(cfn) - FUNC_RANGECHECK;
           }
+          break;
+        }
 #endif
 
 #if defined(GVARS)
-          case FUNC_ADJUST_GVAR:
-            if (CFN_GVAR_MODE(cfn) == FUNC_ADJUST_GVAR_CONSTANT) {
-              SET_GVAR(CFN_GVAR_INDEX(cfn), CFN_PARAM(cfn),
-                       mixerCurrentFlightMode);
-            } else if (CFN_GVAR_MODE(cfn) == FUNC_ADJUST_GVAR_GVAR) {
+        case FUNC_ADJUST_GVAR:
+          if (CFN_GVAR_MODE(cfn) == FUNC_ADJUST_GVAR_CONSTANT) {
+            SET_GVAR(CFN_GVAR_INDEX(cfn), CFN_PARAM(cfn),
+                     mixerCurrentFlightMode);
+          } else if (CFN_GVAR_MODE(cfn) == FUNC_ADJUST_GVAR_GVAR) {
+            SET_GVAR(CFN_GVAR_INDEX(cfn),
+                     GVAR_VALUE(CFN_PARAM(cfn),
+                                getGVarFlightMode(mixerCurrentFlightMode,
+                                                  CFN_PARAM(cfn))),
+                     mixerCurrentFlightMode);
+          } else if (CFN_GVAR_MODE(cfn) == FUNC_ADJUST_GVAR_INCDEC) {
+            if (!(functionsContext.activeSwitches & switch_mask)) {
               SET_GVAR(CFN_GVAR_INDEX(cfn),
-                       GVAR_VALUE(CFN_PARAM(cfn),
-                                  getGVarFlightMode(mixerCurrentFlightMode,
-                                                    CFN_PARAM(cfn))),
+                       limit<int16_t>(MODEL_GVAR_MIN(CFN_GVAR_INDEX(cfn)),
+                                      GVAR_VALUE(CFN_GVAR_INDEX(cfn),
+                                                 getGVarFlightMode(
+                                                     mixerCurrentFlightMode,
+                                                     CFN_GVAR_INDEX(cfn))) +
+                                          CFN_PARAM(cfn),
+                                      MODEL_GVAR_MAX(CFN_GVAR_INDEX(cfn))),
                        mixerCurrentFlightMode);
-            } else if (CFN_GVAR_MODE(cfn) == FUNC_ADJUST_GVAR_INCDEC) {
-              if (!(functionsContext.activeSwitches & switch_mask)) {
-                SET_GVAR(CFN_GVAR_INDEX(cfn),
-                         limit<int16_t>(MODEL_GVAR_MIN(CFN_GVAR_INDEX(cfn)),
-                                        GVAR_VALUE(CFN_GVAR_INDEX(cfn),
-                                                   getGVarFlightMode(
-                                                       mixerCurrentFlightMode,
-                                                       CFN_GVAR_INDEX(cfn))) +
-                                            CFN_PARAM(cfn),
-                                        MODEL_GVAR_MAX(CFN_GVAR_INDEX(cfn))),
-                         mixerCurrentFlightMode);
-              }
-            } else if (CFN_PARAM(cfn) >= MIXSRC_FIRST_TRIM &&
-                       CFN_PARAM(cfn) <= MIXSRC_LAST_TRIM) {
-              trimGvar[CFN_PARAM(cfn) - MIXSRC_FIRST_TRIM] =
-                  CFN_GVAR_INDEX(cfn);
-            } else {
-              if (CFN_GVAR_MODE(cfn) == FUNC_ADJUST_GVAR_SOURCE)
-                SET_GVAR(CFN_GVAR_INDEX(cfn),
-                        limit<int16_t>(MODEL_GVAR_MIN(CFN_GVAR_INDEX(cfn)),
-                                        calcRESXto100(getValue(CFN_PARAM(cfn))),
-                                        MODEL_GVAR_MAX(CFN_GVAR_INDEX(cfn))),
-                        mixerCurrentFlightMode);
-              else
-                SET_GVAR(CFN_GVAR_INDEX(cfn),
-                        limit<int16_t>(MODEL_GVAR_MIN(CFN_GVAR_INDEX(cfn)),
-                                        getValue(CFN_PARAM(cfn)),
-                                        MODEL_GVAR_MAX(CFN_GVAR_INDEX(cfn))),
-                        mixerCurrentFlightMode);
             }
-            break;
+          } else if (CFN_PARAM(cfn) >= MIXSRC_FIRST_TRIM &&
+                     CFN_PARAM(cfn) <= MIXSRC_LAST_TRIM) {
+            trimGvar[CFN_PARAM(cfn) - MIXSRC_FIRST_TRIM] =
+                CFN_GVAR_INDEX(cfn);
+          } else {
+            if (CFN_GVAR_MODE(cfn) == FUNC_ADJUST_GVAR_SOURCE)
+              SET_GVAR(CFN_GVAR_INDEX(cfn),
+                      limit<int16_t>(MODEL_GVAR_MIN(CFN_GVAR_INDEX(cfn)),
+                                      calcRESXto100(getValue(CFN_PARAM(cfn))),
+                                      MODEL_GVAR_MAX(CFN_GVAR_INDEX(cfn))),
+                      mixerCurrentFlightMode);
+            else
+              SET_GVAR(CFN_GVAR_INDEX(cfn),
+                      limit<int16_t>(MODEL_GVAR_MIN(CFN_GVAR_INDEX(cfn)),
+                                      getValue(CFN_PARAM(cfn)),
+                                      MODEL_GVAR_MAX(CFN_GVAR_INDEX(cfn))),
+                      mixerCurrentFlightMode);
+          }
+          break;
 #endif
 
 #if defined(AUDIO)
-          case FUNC_VOLUME: {
-            getvalue_t raw = getValue(CFN_PARAM(cfn));
-            // only set volume if input changed more than hysteresis
-            if (abs(requiredSpeakerVolumeRawLast - raw) > VOLUME_HYSTERESIS) {
-              requiredSpeakerVolumeRawLast = raw;
-            }
-            requiredSpeakerVolume =
-                ((1024 + requiredSpeakerVolumeRawLast) * VOLUME_LEVEL_MAX) /
-                2048;
-            break;
+        case FUNC_VOLUME: {
+          getvalue_t raw = getValue(CFN_PARAM(cfn));
+          // only set volume if input changed more than hysteresis
+          if (abs(requiredSpeakerVolumeRawLast - raw) > VOLUME_HYSTERESIS) {
+            requiredSpeakerVolumeRawLast = raw;
           }
+          requiredSpeakerVolume =
+              ((1024 + requiredSpeakerVolumeRawLast) * VOLUME_LEVEL_MAX) /
+              2048;
+          break;
+        }
 #endif
 
-          case FUNC_PLAY_SOUND:
-          case FUNC_PLAY_TRACK:
-          case FUNC_PLAY_VALUE:
+        case FUNC_PLAY_SOUND:
+        case FUNC_PLAY_TRACK:
+        case FUNC_PLAY_VALUE:
 #if defined(HAPTIC)
-          case FUNC_HAPTIC:
-#endif
-          {
-            if (isRepeatDelayElapsed(functions, functionsContext, i)) {
-              if (!IS_PLAYING(PLAY_INDEX)) {
-                if (CFN_FUNC(cfn) == FUNC_PLAY_SOUND) {
-                  AUDIO_PLAY(AU_SPECIAL_SOUND_FIRST + CFN_PARAM(cfn));
-                } else if (CFN_FUNC(cfn) == FUNC_PLAY_VALUE) {
-                  PLAY_VALUE(CFN_PARAM(cfn), PLAY_INDEX);
-                }
+        case FUNC_HAPTIC:
+#endif
+        {
+          if (isRepeatDelayElapsed(functions, functionsContext, i)) {
+            if (!IS_PLAYING(PLAY_INDEX)) {
+              if (CFN_FUNC(cfn) == FUNC_PLAY_SOUND) {
+                AUDIO_PLAY(AU_SPECIAL_SOUND_FIRST + CFN_PARAM(cfn));
+              } else if (CFN_FUNC(cfn) == FUNC_PLAY_VALUE) {
+                PLAY_VALUE(CFN_PARAM(cfn), PLAY_INDEX);
+              }
 #if defined(HAPTIC)
-                else if (CFN_FUNC(cfn) == FUNC_HAPTIC) {
-                  haptic.event(AU_SPECIAL_SOUND_LAST + CFN_PARAM(cfn));
-                }
+              else if (CFN_FUNC(cfn) == FUNC_HAPTIC) {
+                haptic.event(AU_SPECIAL_SOUND_LAST + CFN_PARAM(cfn));
+              }
 #endif
-                else {
-                  playCustomFunctionFile(cfn, PLAY_INDEX);
-                }
+              else {
+                playCustomFunctionFile(cfn, PLAY_INDEX);
               }
             }
-            break;
           }
+          break;
+        }
 
-          case FUNC_BACKGND_MUSIC:
-            if (!(newActiveFunctions & (1 << FUNCTION_BACKGND_MUSIC))) {
-              newActiveFunctions |= (1 << FUNCTION_BACKGND_MUSIC);
-              if (!IS_PLAYING(PLAY_INDEX)) {
-                playCustomFunctionFile(cfn, PLAY_INDEX);
-              }
+        case FUNC_BACKGND_MUSIC:
+          if (!(newActiveFunctions & (1 << FUNCTION_BACKGND_MUSIC))) {
+            newActiveFunctions |= (1 << FUNCTION_BACKGND_MUSIC);
+            if (!IS_PLAYING(PLAY_INDEX)) {
+              playCustomFunctionFile(cfn, PLAY_INDEX);
             }
-            break;
+          }
+          break;
 
-          case FUNC_BACKGND_MUSIC_PAUSE:
-            newActiveFunctions |= (1 << FUNCTION_BACKGND_MUSIC_PAUSE);
-            break;
+        case FUNC_BACKGND_MUSIC_PAUSE:
+          newActiveFunctions |= (1 << FUNCTION_BACKGND_MUSIC_PAUSE);
+          break;
 
 #if defined(VARIO)
-          case FUNC_VARIO:
-            newActiveFunctions |= (1u << FUNCTION_VARIO);
-            break;
+        case FUNC_VARIO:
+          newActiveFunctions |= (1u << FUNCTION_VARIO);
+          break;
 #endif
 
-          case FUNC_LOGS:
-            if (CFN_PARAM(cfn)) {
-              newActiveFunctions |= (1u << FUNCTION_LOGS);
-              logDelay100ms = CFN_PARAM(
-                  cfn);  // logging period is 0..25.5s in 100ms increments
-            }
-            break;
+        case FUNC_LOGS:
+          if (CFN_PARAM(cfn)) {
+            newActiveFunctions |= (1u << FUNCTION_LOGS);
+            logDelay100ms = CFN_PARAM(
+                cfn);  // logging period is 0..25.5s in 100ms increments
+          }
+          break;
 
 #if defined(FUNCTION_SWITCHES)
-          case FUNC_PUSH_CUST_SWITCH:
-            if (CFN_PARAM(cfn)) {   // Duration is set
-              if (! CFN_VAL2(cfn) ) { // Duration not started yet
-                CFN_VAL2(cfn) = timersGetMsTick() + CFN_PARAM(cfn) * 100;
-                g_model.cfsSetSFState(CFN_CS_INDEX(cfn), 1);
-              } else if (timersGetMsTick() < (uint32_t)CFN_VAL2(cfn) ) {  // Still within push duration
-                g_model.cfsSetSFState(CFN_CS_INDEX(cfn), 1);
-              }
-            } else { // No duration set
+        case FUNC_PUSH_CUST_SWITCH:
+          if (CFN_PARAM(cfn)) {   // Duration is set
+            if (! CFN_VAL2(cfn) ) { // Duration not started yet
+              CFN_VAL2(cfn) = timersGetMsTick() + CFN_PARAM(cfn) * 100;
+              g_model.cfsSetSFState(CFN_CS_INDEX(cfn), 1);
+            } else if (timersGetMsTick() < (uint32_t)CFN_VAL2(cfn) ) {  // Still within push duration
               g_model.cfsSetSFState(CFN_CS_INDEX(cfn), 1);
             }
-            break;
+          } else { // No duration set
+            g_model.cfsSetSFState(CFN_CS_INDEX(cfn), 1);
+          }
+          break;
 #endif
 
-          case FUNC_BACKLIGHT: {
-            newActiveFunctions |= (1u << FUNCTION_BACKLIGHT);
-            if (!CFN_PARAM(cfn)) {  // When no source is set, backlight works
-                                    // like original backlight and turn on
-                                    // regardless of backlight settings
-              requiredBacklightBright = BACKLIGHT_FORCED_ON;
-              break;
-            }
+        case FUNC_BACKLIGHT: {
+          newActiveFunctions |= (1u << FUNCTION_BACKLIGHT);
+          if (!CFN_PARAM(cfn)) {  // When no source is set, backlight works
+                                  // like original backlight and turn on
+                                  // regardless of backlight settings
+            requiredBacklightBright = BACKLIGHT_FORCED_ON;
+            break;
+          }
 
-            getvalue_t raw = limit(-RESX, (int)getValue(CFN_PARAM(cfn)), RESX);
+          getvalue_t raw = limit(-RESX, (int)getValue(CFN_PARAM(cfn)), RESX);
 #if defined(COLORLCD)
-            requiredBacklightBright = BACKLIGHT_LEVEL_MAX - (g_eeGeneral.blOffBright +
-                ((1024 + raw) * ((BACKLIGHT_LEVEL_MAX - g_eeGeneral.backlightBright) - g_eeGeneral.blOffBright) / 2048));
+          requiredBacklightBright = BACKLIGHT_LEVEL_MAX - (g_eeGeneral.blOffBright +
+              ((1024 + raw) * ((BACKLIGHT_LEVEL_MAX - g_eeGeneral.backlightBright) - g_eeGeneral.blOffBright) / 2048));
 #elif defined(OLED_SCREEN)
-            requiredBacklightBright = (raw + 1024) * 254 / 2048;
+          requiredBacklightBright = (raw + 1024) * 254 / 2048;
 #else
-            requiredBacklightBright = (1024 - raw) * 100 / 2048;
+          requiredBacklightBright = (1024 - raw) * 100 / 2048;
 #endif
-            break;
-          }
+          break;
+        }
 
-          case FUNC_SCREENSHOT:
-            if (!(functionsContext.activeSwitches & switch_mask)) {
-              mainRequestFlags |= (1u << REQUEST_SCREENSHOT);
-            }
-            break;
+        case FUNC_SCREENSHOT:
+          if (!(functionsContext.activeSwitches & switch_mask)) {
+            mainRequestFlags |= (1u << REQUEST_SCREENSHOT);
+          }
+          break;
 
 #if defined(PXX2)
-          case FUNC_RACING_MODE:
-            if (isRacingModeEnabled()) {
-              newActiveFunctions |= (1u << FUNCTION_RACING_MODE);
-            }
-            break;
+        case FUNC_RACING_MODE:
+          if (isRacingModeEnabled()) {
+            newActiveFunctions |= (1u << FUNCTION_RACING_MODE);
+          }
+          break;
 #endif
 #if defined(HARDWARE_TOUCH)
-          case FUNC_DISABLE_TOUCH:
-            newActiveFunctions |= (1u << FUNCTION_DISABLE_TOUCH);
-            break;
+        case FUNC_DISABLE_TOUCH:
+          newActiveFunctions |= (1u << FUNCTION_DISABLE_TOUCH);
+          break;
 #endif
 #if defined(AUDIO_MUTE_GPIO)
-          case FUNC_DISABLE_AUDIO_AMP:
-            newActiveFunctions |= (1u << FUNCTION_DISABLE_AUDIO_AMP);
-            break;
+        case FUNC_DISABLE_AUDIO_AMP:
+          newActiveFunctions |= (1u << FUNCTION_DISABLE_AUDIO_AMP);
+          break;
 #endif
-          case FUNC_SET_SCREEN:
-            if (isRepeatDelayElapsed(functions, functionsContext, i)) {
-              TRACE("SET VIEW %d", (CFN_PARAM(cfn)));
+        case FUNC_SET_SCREEN:
+          if (isRepeatDelayElapsed(functions, functionsContext, i)) {
+            TRACE("SET VIEW %d", (CFN_PARAM(cfn)));
 #if defined(COLORLCD)
-              int8_t screenNumber = max(0, CFN_PARAM(cfn) - 1);
-              setRequestedMainView(screenNumber);
-              mainRequestFlags |= (1u << REQUEST_MAIN_VIEW);
+            int8_t screenNumber = max(0, CFN_PARAM(cfn) - 1);
+            setRequestedMainView(screenNumber);
+            mainRequestFlags |= (1u << REQUEST_MAIN_VIEW);
 #else
-              extern void showTelemScreen(uint8_t index);
-              showTelemScreen(CFN_PARAM(cfn));
+            extern void showTelemScreen(uint8_t index);
+            showTelemScreen(CFN_PARAM(cfn));
 #endif
-            }
-            break;
+          }
+          break;
 #if defined(VIDEO_SWITCH)
-          case FUNC_LCD_TO_VIDEO:
-            switchToVideo();
-            videoEnabled = true;
-            break;
+        case FUNC_LCD_TO_VIDEO:
+          switchToVideo();
+          videoEnabled = true;
+          break;
 #endif
 #if defined(DEBUG)
-          case FUNC_TEST:
-            testFunc();
-            break;
+        case FUNC_TEST:
+          testFunc();
+          break;
 #endif
-        }
+      }
 
-        newActiveSwitches |= switch_mask;
-      } else {
+      newActiveSwitches |= switch_mask;
+    } else {
 #if defined(FUNCTION_SWITCHES)
-        if (CFN_FUNC(cfn) == FUNC_PUSH_CUST_SWITCH) {
-          // Handling duration after function is active
-          if (timersGetMsTick() < (uint32_t)CFN_VAL2(cfn)) {
-            g_model.cfsSetSFState(CFN_CS_INDEX(cfn), 1);
-          }
-          else {
-            CFN_VAL2(cfn) = 0;
-          }
+      if (CFN_FUNC(cfn) == FUNC_PUSH_CUST_SWITCH) {
+        // Handling duration after function is active
+        if (timersGetMsTick() < (uint32_t)CFN_VAL2(cfn)) {
+          g_model.cfsSetSFState(CFN_CS_INDEX(cfn), 1);
+        }
+        else {
+          CFN_VAL2(cfn) = 0;
         }
+      }
 #endif
-        functionsContext.lastFunctionTime[i] = 0;
+      functionsContext.lastFunctionTime[i] = 0;
 #if defined(DANGEROUS_MODULE_FUNCTIONS)
-        if (functionsContext.activeSwitches & switch_mask) {
-          switch (CFN_FUNC(cfn)) {
-            case FUNC_RANGECHECK:
-            case FUNC_BIND:
-            {
-              unsigned int moduleIndex = CFN_PARAM(cfn);
-              if (moduleIndex < NUM_MODULES) {
-                moduleState[moduleIndex].mode = 0;
-              }
-              break;
+      if (functionsContext.activeSwitches & switch_mask) {
+        switch (CFN_FUNC(cfn)) {
+          case FUNC_RANGECHECK:
+          case FUNC_BIND:
+          {
+            unsigned int moduleIndex = CFN_PARAM(cfn);
+            if (moduleIndex < NUM_MODULES) {
+              moduleState[moduleIndex].mode = 0;
             }
+            break;
           }
         }
-#endif
       }
+#endif
     }
   }
 
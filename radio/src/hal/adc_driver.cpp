@@ -26,6 +26,7 @@
 #endif
 
 #include "edgetx.h"
+#include "latency_trace.h"
 
 const etx_hal_adc_driver_t* _hal_adc_driver = nullptr;
 const etx_hal_adc_inputs_t* _hal_adc_inputs = nullptr;
@@ -126,6 +127,8 @@ static void writeAnalogCalib(uint8_t input, int16_t low, int16_t mid, int16_t hi
 
   v = high - mid;
   calib.spanPos = v - v / STICK_TOLERANCE;
+
+  adcInvalidatePipeline();
 }
 
 static void writeXPotCalib(uint8_t input, int16_t* steps, uint8_t n_steps)
@@ -138,6 +141,8 @@ static void writeXPotCalib(uint8_t input, int16_t* steps, uint8_t n_steps)
   for (int i = 0; i < calib->count; i++) {
     calib->steps[i] = (steps[i + 1] + steps[i]) >> XPOT_CALIB_SHIFT;
   }
+
+  adcInvalidatePipeline();
 }
 
 void adcCalibSetMinMax()
@@ -300,7 +305,7 @@ tmr10ms_t jitterResetTime = 0;
 #endif
 
 static uint32_t apply_low_pass_filter(uint32_t v, uint32_t v_prev,
-                                      bool is_main_input)
+                                      bool use_jitter_filter)
 {
   // Jitter filter:
   //    * pass trough any big change directly
@@ -337,23 +342,8 @@ static uint32_t apply_low_pass_filter(uint32_t v, uint32_t v_prev,
   uint32_t previous = v_prev / JITTER_ALPHA;
   uint32_t diff = (v > previous) ? (v - previous) : (previous - v);
 
-  // Combine ADC jitter filter setting form radio and model.
-  // Model can override (on or off) or use setting from radio setup.
-  // Model setting is active when 1, radio setting is active when 0
-  // Please note: these settings only apply to main controls.
-  bool useJitterFilter = true;
-  if (is_main_input) {
-    if (g_model.jitterFilter == OVERRIDE_GLOBAL) {
-      // Use radio setting - which is inverted
-      useJitterFilter = !g_eeGeneral.noJitterFilter;
-    } else {
-      // Enable if value is "On", disable if "Off"
-      useJitterFilter = (g_model.jitterFilter == OVERRIDE_ON);
-    }
-  }
-
   uint32_t out;
-  if (useJitterFilter && diff < (10 * ANALOG_MULTIPLIER)) {
+  if (use_jitter_filter && diff < (10 * ANALOG_MULTIPLIER)) {
     // apply jitter filter
     out = (v_prev - previous) + v;
   } else {
@@ -364,14 +354,140 @@ static uint32_t apply_low_pass_filter(uint32_t v, uint32_t v_prev,
   return out;
 }
 
-static uint32_t apply_calibration(const CalibData* calib, uint32_t v)
+// Input pipeline:
+//
+// Everything getADC() needs to know about an input that only changes
+// when calibration, pots configuration, stick mode or the model change
+// is resolved once into a per-input descriptor. The per-tick loop is
+// then reduced to a few multiplications and flag tests.
+//
+// The calibration division is replaced by a multiplication with a
+// reciprocal scaled by 2^ADC_RECIP_SHIFT: with a span below 8192 and
+// |s| < 2^13, the rounding error stays below 1/span, which gives exactly
+// the same result as the integer division.
+//
+#define ADC_RECIP_SHIFT 36
+static_assert(RESX == (1 << 10), "RESX is used as a shift");
+
+enum AdcInputDescFlags {
+  ADC_DESC_CALIB = (1 << 0),
+  ADC_DESC_INVERT = (1 << 1),
+  ADC_DESC_FILTER = (1 << 2),
+  ADC_DESC_MULTIPOS = (1 << 3),
+};
+
+struct AdcInputDesc {
+  int32_t mid;            // 2 * calibration mid-point
+  uint32_t spanPosRecip;  // 2^ADC_RECIP_SHIFT / spanPos
+  uint32_t spanNegRecip;  // 2^ADC_RECIP_SHIFT / spanNeg
+  uint8_t flags;
+  uint8_t multipos;       // index into adcMultipos[]
+};
+
+struct AdcMultiposDesc {
+  uint8_t count;
+  uint8_t steps[XPOTS_MULTIPOS_COUNT - 1];
+  uint32_t values[XPOTS_MULTIPOS_COUNT];
+};
+
+static AdcInputDesc adcPipeline[MAX_ANALOG_INPUTS];
+static AdcMultiposDesc adcMultipos[MAX_POTS];
+static volatile bool adcPipelineDirty = true;
+
+void adcInvalidatePipeline()
+{
+  adcPipelineDirty = true;
+}
+
+static uint32_t calib_recip(int16_t span)
+{
+  return ((uint64_t(1) << ADC_RECIP_SHIFT) + max((int16_t)100, span) - 1) /
+         max((int16_t)100, span);
+}
+
+static void compile_multipos(AdcMultiposDesc* desc, const StepsCalibData* calib)
+{
+  constexpr uint32_t ALPHA_MULT = JITTER_ALPHA * ANALOG_MULTIPLIER;
+  constexpr uint32_t ANAFILT_MAX = 2 * RESX * ALPHA_MULT;
+
+  desc->count = calib->count;
+  for (uint32_t i = 0; i < calib->count; i++) {
+    desc->steps[i] = calib->steps[i];
+    desc->values[i] = (i * (ANAFILT_MAX + ALPHA_MULT)) / calib->count;
+  }
+  desc->values[calib->count] = ANAFILT_MAX;
+}
+
+static void compile_pipeline()
+{
+  auto max_analogs = adcGetMaxInputs(ADC_INPUT_ALL);
+  auto max_mains = adcGetMaxInputs(ADC_INPUT_MAIN);
+  auto max_pots = adcGetMaxInputs(ADC_INPUT_FLEX);
+  auto pot_offset = adcGetInputOffset(ADC_INPUT_FLEX);
+  auto max_calib_analogs = adcGetMaxCalibratedInputs();
+
+  // Combine ADC jitter filter setting form radio and model.
+  // Model can override (on or off) or use setting from radio setup.
+  // Model setting is active when 1, radio setting is active when 0
+  // Please note: these settings only apply to main controls.
+  bool mainJitterFilter;
+  if (g_model.jitterFilter == OVERRIDE_GLOBAL) {
+    // Use radio setting - which is inverted
+    mainJitterFilter = !g_eeGeneral.noJitterFilter;
+  } else {
+    // Enable if value is "On", disable if "Off"
+    mainJitterFilter = (g_model.jitterFilter == OVERRIDE_ON);
+  }
+
+  for (uint8_t x = 0; x < max_analogs; x++) {
+    auto& desc = adcPipeline[x];
+    desc.flags = 0;
+
+    bool is_flex_input = (x >= pot_offset) && (x < pot_offset + max_pots);
+    bool is_multipos = is_flex_input && IS_POT_MULTIPOS(x - pot_offset);
+
+    if (x < max_calib_analogs && !is_multipos) {
+      const auto& calib = g_eeGeneral.calib[x];
+      desc.flags |= ADC_DESC_CALIB;
+      desc.mid = 2 * calib.mid;
+      desc.spanPosRecip = calib_recip(calib.spanPos);
+      desc.spanNegRecip = calib_recip(calib.spanNeg);
+    }
+
+    if (x < pot_offset && getStickInversion(inputMappingConvertMode(x))) {
+      desc.flags |= ADC_DESC_INVERT;
+    }
+
+    if (is_flex_input && getPotInversion(x - pot_offset)) {
+      desc.flags |= ADC_DESC_INVERT;
+    }
+
+    if (x >= max_mains || mainJitterFilter) {
+      desc.flags |= ADC_DESC_FILTER;
+    }
+
+    if (is_multipos) {
+      const auto* calib = (const StepsCalibData*)&g_eeGeneral.calib[x];
+      if (IS_MULTIPOS_CALIBRATED(calib)) {
+        desc.flags |= ADC_DESC_MULTIPOS;
+        desc.multipos = x - pot_offset;
+        compile_multipos(&adcMultipos[desc.multipos], calib);
+      }
+    }
+  }
+}
+
+static uint32_t apply_calibration(const AdcInputDesc* desc, uint32_t v)
 {
   // Simu uses normed inputs
 #if !defined(SIMU)
   // Apply calibration relative to mid-point
-  int32_t s = v - 2 * calib->mid;
-  s = s * (int32_t)RESX /
-      (max((int16_t)100, (s > 0 ? calib->spanPos : calib->spanNeg)));
+  int32_t s = v - desc->mid;
+  if (s > 0) {
+    s = (uint64_t(s) * desc->spanPosRecip) >> (ADC_RECIP_SHIFT - 10);
+  } else {
+    s = -int32_t((uint64_t(-s) * desc->spanNegRecip) >> (ADC_RECIP_SHIFT - 10));
+  }
 
   // Translate back in range
   s += 2 * RESX;
@@ -389,31 +505,23 @@ static uint32_t apply_calibration(const CalibData* calib, uint32_t v)
   return v;
 }
 
-static uint32_t apply_multipos(const StepsCalibData* calib, uint32_t v)
+static uint32_t apply_multipos(const AdcMultiposDesc* desc, uint32_t v)
 {
   constexpr uint32_t ALPHA_MULT = JITTER_ALPHA * ANALOG_MULTIPLIER;
-  constexpr uint32_t ANAFILT_MAX = 2 * RESX * ALPHA_MULT;
 
   // TODO: consider adding another low pass filter to eliminate multipos
   // switching glitches
   uint8_t vShifted = (v / ALPHA_MULT) >> 4;
 
-  for (uint32_t i = 0; i < calib->count; i++) {
-    if (vShifted < calib->steps[i]) {
-      return (i * (ANAFILT_MAX + ALPHA_MULT)) / calib->count;
-    }
-  }
+  uint32_t i = 0;
+  while (i < desc->count && vShifted >= desc->steps[i]) i++;
 
-  return ANAFILT_MAX;
+  return desc->values[i];
 }
 
 void getADC()
 {
   auto max_analogs = adcGetMaxInputs(ADC_INPUT_ALL);
-  auto max_mains = adcGetMaxInputs(ADC_INPUT_MAIN);
-  auto max_pots = adcGetMaxInputs(ADC_INPUT_FLEX);
-  auto pot_offset = adcGetInputOffset(ADC_INPUT_FLEX);
-  auto max_calib_analogs = adcGetMaxCalibratedInputs();
 
 #if defined(JITTER_MEASURE)
   if (JITTER_MEASURE_ACTIVE() && jitterResetTime < get_tmr10ms()) {
@@ -429,36 +537,34 @@ void getADC()
   DEBUG_TIMER_START(debugTimerAdcRead);
   if (!adcRead()) { TRACE("adcRead failed"); }
   DEBUG_TIMER_STOP(debugTimerAdcRead);
+  LATENCY_TRACE_STAGE(LATENCY_STAGE_ADC);
 
-  for (uint8_t x = 0; x < max_analogs; x++) {
+  if (adcPipelineDirty) {
+    adcPipelineDirty = false;
+    compile_pipeline();
+  }
 
-    bool is_flex_input = (x >= pot_offset) && (x < pot_offset + max_pots);
-    bool is_multipos = is_flex_input && IS_POT_MULTIPOS(x - pot_offset);
+  for (uint8_t x = 0; x < max_analogs; x++) {
+    const auto& desc = adcPipeline[x];
 
     // 1st: apply calibration
     uint32_t v = getAnalogValue(x);
 
-    if (x < max_calib_analogs && !is_multipos) {
-      v = apply_calibration(&g_eeGeneral.calib[x], v);
+    if (desc.flags & ADC_DESC_CALIB) {
+      v = apply_calibration(&desc, v);
     }
 
     // 2nd: apply inversion
-    if (x < pot_offset && getStickInversion(inputMappingConvertMode(x))) {
-      v = 4 * RESX - v;
-    }
-
-    if (is_flex_input && getPotInversion(x - pot_offset)) {
+    if (desc.flags & ADC_DESC_INVERT) {
       v = 4 * RESX - v;
     }
 
     // 3rd: apply filtering
-    s_anaFilt[x] = apply_low_pass_filter(v, s_anaFilt[x], x < max_mains);
+    s_anaFilt[x] = apply_low_pass_filter(v, s_anaFilt[x],
+                                         desc.flags & ADC_DESC_FILTER);
 
-    if (is_multipos) {
-      const auto* calib = (const StepsCalibData*)&g_eeGeneral.calib[x];
-      if (IS_MULTIPOS_CALIBRATED(calib)) {
-        s_anaFilt[x] = apply_multipos(calib, s_anaFilt[x]);
-      }
+    if (desc.flags & ADC_DESC_MULTIPOS) {
+      s_anaFilt[x] = apply_multipos(&adcMultipos[desc.multipos], s_anaFilt[x]);
     }
 
 #if defined(JITTER_MEASURE)
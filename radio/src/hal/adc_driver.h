@@ -111,6 +111,10 @@ extern JitterMeter<uint16_t> rawJitter[MAX_ANALOG_INPUTS];
 extern JitterMeter<uint16_t> avgJitter[MAX_ANALOG_INPUTS];
 #endif
 
+// Rebuild the per-input processing pipeline before next getADC()
+// (calibration, pots configuration, stick mode or model changed)
+void adcInvalidatePipeline();
+
 void getADC();
 uint16_t anaIn(uint8_t chan);
 uint32_t anaIn_diag(uint8_t chan);
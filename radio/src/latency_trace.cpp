@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "latency_trace.h"
+#include "timers_driver.h"
+#include "tasks/mixer_task.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Stage times are stored relative to the ADC sample,
+// saturated to 65ms
+struct LatencyRecord {
+  uint16_t mixer;
+  uint16_t send;
+  uint8_t module;
+  uint8_t protocol;
+};
+
+enum LatencyMetric {
+  LATENCY_ADC_TO_MIXER,
+  LATENCY_MIXER_TO_SEND,
+  LATENCY_ADC_TO_SEND,
+  LATENCY_METRICS_COUNT
+};
+
+static const char * const latencyMetricNames[LATENCY_METRICS_COUNT] = {
+  "adc-mix ",
+  "mix-send",
+  "adc-send",
+};
+
+static uint32_t stageTime[LATENCY_STAGE_COUNT];
+
+static LatencyRecord records[LATENCY_TRACE_RECORDS];
+static uint16_t recordsNext;
+static uint16_t recordsCount;
+
+// report scratch buffers (not on the caller stack)
+static LatencyRecord snapshot[LATENCY_TRACE_RECORDS];
+static uint16_t samples[LATENCY_TRACE_RECORDS];
+
+static inline uint16_t latencyDelta(uint32_t from, uint32_t to)
+{
+  uint32_t delta = to - from;
+  return delta > UINT16_MAX ? UINT16_MAX : delta;
+}
+
+void latencyTraceStage(uint8_t stage)
+{
+  if (stage < LATENCY_STAGE_COUNT) {
+    stageTime[stage] = timersGetUsTick();
+  }
+}
+
+void latencyTraceFrame(uint8_t module, uint8_t protocol)
+{
+  uint32_t now = timersGetUsTick();
+  uint32_t adc = stageTime[LATENCY_STAGE_ADC];
+
+  LatencyRecord& record = records[recordsNext];
+  record.mixer = latencyDelta(adc, stageTime[LATENCY_STAGE_MIXER]);
+  record.send = latencyDelta(adc, now);
+  record.module = module;
+  record.protocol = protocol;
+
+  recordsNext = (recordsNext + 1) % LATENCY_TRACE_RECORDS;
+  if (recordsCount < LATENCY_TRACE_RECORDS) recordsCount++;
+}
+
+void latencyTraceReset()
+{
+  mixerTaskLock();
+  recordsNext = 0;
+  recordsCount = 0;
+  mixerTaskUnlock();
+}
+
+static uint16_t recordMetric(const LatencyRecord& record, uint8_t metric)
+{
+  switch (metric) {
+    case LATENCY_ADC_TO_MIXER:
+      return record.mixer;
+    case LATENCY_MIXER_TO_SEND:
+      return record.send - record.mixer;
+    default:
+      return record.send;
+  }
+}
+
+static void sortSamples(uint16_t * values, uint16_t count)
+{
+  for (uint16_t i = 1; i < count; i++) {
+    uint16_t value = values[i];
+    uint16_t j = i;
+    while (j > 0 && values[j - 1] > value) {
+      values[j] = values[j - 1];
+      j--;
+    }
+    values[j] = value;
+  }
+}
+
+// nearest-rank percentile of sorted values
+static uint16_t percentile(const uint16_t * values, uint16_t count, uint8_t p)
+{
+  uint32_t rank = (count * p + 99) / 100;
+  return values[rank > 0 ? rank - 1 : 0];
+}
+
+static void reportGroup(LatencyTraceOutput output, uint16_t count,
+                        uint8_t module, uint8_t protocol)
+{
+  char line[96];
+
+  uint16_t frames = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    if (snapshot[i].module == module && snapshot[i].protocol == protocol)
+      frames++;
+  }
+
+  snprintf(line, sizeof(line), "Module %u protocol %u: %u frames",
+           module, protocol, frames);
+  output(line);
+
+  for (uint8_t metric = 0; metric < LATENCY_METRICS_COUNT; metric++) {
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < count; i++) {
+      const LatencyRecord& record = snapshot[i];
+      if (record.module == module && record.protocol == protocol)
+        samples[n++] = recordMetric(record, metric);
+    }
+    sortSamples(samples, n);
+
+    snprintf(line, sizeof(line),
+             "  %s min %uus p50 %uus p99 %uus max %uus",
+             latencyMetricNames[metric], samples[0],
+             percentile(samples, n, 50), percentile(samples, n, 99),
+             samples[n - 1]);
+    output(line);
+  }
+
+  // histogram of the total latency
+  uint16_t buckets[LATENCY_TRACE_BUCKETS + 1] = {};
+  for (uint16_t i = 0; i < count; i++) {
+    const LatencyRecord& record = snapshot[i];
+    if (record.module == module && record.protocol == protocol) {
+      uint16_t bucket = record.send / LATENCY_TRACE_BUCKET_US;
+      if (bucket > LATENCY_TRACE_BUCKETS) bucket = LATENCY_TRACE_BUCKETS;
+      buckets[bucket]++;
+    }
+  }
+
+  int len = snprintf(line, sizeof(line), "  hist/%uus:", LATENCY_TRACE_BUCKET_US);
+  for (uint8_t i = 0; i <= LATENCY_TRACE_BUCKETS && len < (int)sizeof(line); i++) {
+    len += snprintf(line + len, sizeof(line) - len,
+                    i < LATENCY_TRACE_BUCKETS ? " %u" : " >%u", buckets[i]);
+  }
+  output(line);
+}
+
+void latencyTraceReport(LatencyTraceOutput output)
+{
+  mixerTaskLock();
+  uint16_t count = recordsCount;
+  memcpy(snapshot, records, sizeof(snapshot));
+  mixerTaskUnlock();
+
+  if (count == 0) {
+    output("No frame traced");
+    return;
+  }
+
+  // one group per module and protocol, in order of first appearance
+  for (uint16_t i = 0; i < count; i++) {
+    bool reported = false;
+    for (uint16_t j = 0; j < i; j++) {
+      if (snapshot[j].module == snapshot[i].module &&
+          snapshot[j].protocol == snapshot[i].protocol) {
+        reported = true;
+        break;
+      }
+    }
+    if (!reported) {
+      reportGroup(output, count, snapshot[i].module, snapshot[i].protocol);
+    }
+  }
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Stick to module latency tracer (LATENCY_TRACE build option)
+//
+// Each mixer cycle is timestamped with timersGetUsTick() when:
+//  - the ADC inputs have been sampled (getADC())
+//  - evalMixes() is done
+//  - a module frame has been handed to the module driver
+//
+// Each module frame is stored as one record in a fixed ring buffer,
+// from which latency histograms and percentiles are computed per
+// module and protocol.
+
+enum LatencyStage {
+  LATENCY_STAGE_ADC,
+  LATENCY_STAGE_MIXER,
+  LATENCY_STAGE_COUNT
+};
+
+#if defined(LATENCY_TRACE)
+
+#define LATENCY_TRACE_RECORDS        256
+#define LATENCY_TRACE_BUCKET_US      500
+#define LATENCY_TRACE_BUCKETS        10
+
+void latencyTraceStage(uint8_t stage);
+void latencyTraceFrame(uint8_t module, uint8_t protocol);
+void latencyTraceReset();
+
+// Report is written line by line (without line ending)
+typedef void (*LatencyTraceOutput)(const char * line);
+void latencyTraceReport(LatencyTraceOutput output);
+
+#define LATENCY_TRACE_STAGE(stage)             latencyTraceStage(stage)
+#define LATENCY_TRACE_FRAME(module, protocol)  latencyTraceFrame(module, protocol)
+
+#else
+
+#define LATENCY_TRACE_STAGE(stage)
+#define LATENCY_TRACE_FRAME(module, protocol)
+
+#endif
@@ -1134,6 +1134,8 @@ void evalMixes(uint8_t tick10ms)
   static uint16_t delta = 0;
   static uint16_t flightModesFade = 0;
 
+  switchesCacheUpdate();
+
   uint8_t fm = getFlightMode();
 
   if (lastFlightMode != fm) {
@@ -1259,6 +1261,8 @@ void evalMixes(uint8_t tick10ms)
       }
     }
   }
+
+  switchesCacheInvalidate();
 }
 
 #if defined(THRTRACE)
@@ -2,27 +2,179 @@
 #include "debug.h"
 #include "timer_native_impl.h"
 
-#include <algorithm>
-
 using namespace std::chrono_literals;
 
 static timer_queue* _instance = nullptr;
 static std::mutex _instance_mut;
 
-bool _timer_cmp(timer_handle_t *lh, timer_handle_t *rh) {
-  return lh->next_trigger < rh->next_trigger;
+// readable without instantiating the timer queue (see simuTimerMicros())
+static std::atomic_bool _virtual_time_enabled = false;
+
+static inline unsigned _slot_index(uint64_t t, unsigned level)
+{
+  return (t >> (TIMER_WHEEL_BITS * level)) & TIMER_WHEEL_MASK;
 }
 
-timer_queue::timer_queue() {
-  start();
+void timer_wheel::link(timer_handle_t* t)
+{
+  uint64_t delta = t->expires - _now;
+  uint64_t slot_time = t->expires;
+
+  unsigned level = 0;
+  while (level < TIMER_WHEEL_LEVELS - 1 &&
+         delta >= (1ULL << (TIMER_WHEEL_BITS * (level + 1)))) {
+    level++;
+  }
+
+  // out of range: park in the last slot reachable on the top level,
+  // it will be re-inserted when cascaded
+  uint64_t range = 1ULL << (TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS);
+  if (delta >= range) slot_time = _now + range - 1;
+
+  timer_handle_t** head = &_slots[level][_slot_index(slot_time, level)];
+  t->next = *head;
+  if (t->next) t->next->pprev = &t->next;
+  t->pprev = head;
+  *head = t;
+}
+
+void timer_wheel::unlink(timer_handle_t* t)
+{
+  *t->pprev = t->next;
+  if (t->next) t->next->pprev = t->pprev;
+  t->next = nullptr;
+  t->pprev = nullptr;
+}
+
+void timer_wheel::add(timer_handle_t* t, uint64_t expires)
+{
+  if (t->pprev) {
+    unlink(t);
+  } else {
+    _count++;
+  }
+  t->expires = expires > _now ? expires : _now + 1;
+  link(t);
+}
+
+void timer_wheel::remove(timer_handle_t* t)
+{
+  if (!t->pprev) return;
+  unlink(t);
+  _count--;
+}
+
+void timer_wheel::cascade(unsigned level)
+{
+  timer_handle_t** head = &_slots[level][_slot_index(_now, level)];
+  timer_handle_t* t = *head;
+  *head = nullptr;
+
+  while (t) {
+    timer_handle_t* next = t->next;
+    link(t);
+    t = next;
+  }
+}
+
+timer_handle_t* timer_wheel::take_all()
+{
+  timer_handle_t* list = nullptr;
+  for (unsigned level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+    for (unsigned i = 0; i < TIMER_WHEEL_SIZE; i++) {
+      timer_handle_t* t = _slots[level][i];
+      _slots[level][i] = nullptr;
+      while (t) {
+        timer_handle_t* next = t->next;
+        t->next = list;
+        t->pprev = nullptr;
+        list = t;
+        t = next;
+      }
+    }
+  }
+  _count = 0;
+  return list;
+}
+
+void timer_wheel::rebase(uint64_t now)
+{
+  timer_handle_t* t = take_all();
+  uint64_t old_now = _now;
+  _now = now;
+
+  while (t) {
+    timer_handle_t* next = t->next;
+    add(t, now + (t->expires - old_now));
+    t = next;
+  }
+}
+
+void timer_wheel::clear()
+{
+  timer_handle_t* t = take_all();
+  while (t) {
+    timer_handle_t* next = t->next;
+    t->next = nullptr;
+    t->active = false;
+    t = next;
+  }
+}
+
+timer_handle_t* timer_wheel::tick()
+{
+  _now++;
+
+  // cascade upper levels first, so that timers moving down
+  // can still reach the current slot on lower levels
+  for (unsigned level = TIMER_WHEEL_LEVELS - 1; level > 0; level--) {
+    if ((_now & ((1ULL << (TIMER_WHEEL_BITS * level)) - 1)) == 0) {
+      cascade(level);
+    }
+  }
+
+  timer_handle_t** head = &_slots[0][_slot_index(_now, 0)];
+  timer_handle_t* expired = *head;
+  *head = nullptr;
+
+  for (timer_handle_t* t = expired; t; t = t->next) {
+    t->pprev = nullptr;
+    _count--;
+  }
+
+  return expired;
 }
 
-void timer_queue::update_current_time() {
-  _current_time = std::chrono::steady_clock::now();
+uint64_t timer_wheel::next_event() const
+{
+  if (_count == 0) return UINT64_MAX;
+
+  for (uint64_t t = _now + 1;; t++) {
+    // cascading is needed on the next first level wrap
+    if (_slots[0][_slot_index(t, 0)] || (t & TIMER_WHEEL_MASK) == 0) {
+      return t;
+    }
+  }
 }
 
-void timer_queue::sort_timers() {
-  std::sort(_timers.begin(), _timers.end(), _timer_cmp);
+void timer_wheel::skip_to(uint64_t now)
+{
+  uint64_t next = next_event();
+  if (next != UINT64_MAX && next <= now) now = next - 1;
+  if (now > _now) _now = now;
+}
+
+timer_queue::timer_queue() :
+  _epoch(time_point_t{})
+{
+  _wheel.rebase(real_time_ms());
+  start();
+}
+
+uint64_t timer_queue::real_time_ms() const
+{
+  auto elapsed = std::chrono::steady_clock::now() - _epoch;
+  return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
 }
 
 timer_queue& timer_queue::instance()
@@ -46,7 +198,7 @@ void timer_queue::destroy()
 
 void timer_queue::start()
 {
-  std::lock_guard<std::mutex> lock(_cmds_mutex);
+  std::lock_guard<std::mutex> lock(_mutex);
   if (!_running) {
     _running = true;
     _thread = std::make_unique<std::thread>([&]() { main_loop(); });
@@ -54,13 +206,17 @@ void timer_queue::start()
 }
 
 void timer_queue::stop() {
-  std::unique_lock<std::mutex> lock(_cmds_mutex);
+  std::unique_lock<std::mutex> lock(_mutex);
   if (_running) {
     _running = false;
     lock.unlock();
-    _cmds_condition.notify_one();
+    _condition.notify_one();
   }
   _thread->join();
+
+  // timers are static objects and may be started again later
+  lock.lock();
+  _wheel.clear();
   TRACE("<timer_queue> stopped");
 }
 
@@ -70,122 +226,133 @@ void timer_queue::create_timer(timer_handle_t *timer, timer_func_t func, const c
   timer->name = name;
   timer->period = period;
   timer->repeat = repeat;
-  timer->next_trigger = time_point_t{};
+  timer->expires = 0;
 }
 
-void timer_queue::send_cmd(timer_req_t&& req)
-{
+void timer_queue::start_timer(timer_handle_t *timer) {
   {
-    std::lock_guard lock(_cmds_mutex);
-    _cmds.emplace_back(req);
+    std::lock_guard lock(_mutex);
+    uint64_t now = _virtual_time ? _wheel.now() : real_time_ms();
+    timer->active = true;
+    _wheel.add(timer, now + timer->period);
   }
-  _cmds_condition.notify_one();
-}
-
-void timer_queue::start_timer(timer_handle_t *timer) {
-  send_cmd(timer_req_t{.cmd = timer_req_t::cmd_start, .timer = timer});
+  // the new timer might expire before the current wait ends
+  _condition.notify_one();
 }
 
 void timer_queue::stop_timer(timer_handle_t *timer) {
-  send_cmd(timer_req_t{.cmd = timer_req_t::cmd_stop, .timer = timer});
+  std::lock_guard lock(_mutex);
+  _wheel.remove(timer);
+  timer->active = false;
 }
 
 void timer_queue::pend_function(timer_async_func_t func, void *param1,
                                 uint32_t param2) {
-  send_cmd(timer_req_t{
-      .cmd = timer_req_t::cmd_pend_func,
-      .func_call = {.func = func, .param1 = param1, .param2 = param2}});
+  if (!func) return;
+  {
+    std::lock_guard lock(_mutex);
+    _funcs.emplace_back(timer_async_call_t{func, param1, param2});
+  }
+  _condition.notify_one();
 }
 
 void timer_queue::main_loop() {
 
   TRACE("<timer_queue> started");
-  while (true) {
-    {
-      std::unique_lock lock(_cmds_mutex);
-      time_point_t until;
-      
-      update_current_time();
-      process_cmds();
-
-      if (_timers.size() > 0) {
-        timer_handle_t* t = _timers[0];
-        until = t->next_trigger;
-      } else {
-        until = _current_time + std::chrono::milliseconds(1000);
-      }
+  std::unique_lock lock(_mutex);
+  while (_running) {
+    // virtual time is driven by advance()
+    if (_virtual_time) {
+      _condition.wait(lock);
+      continue;
+    }
 
-      std::cv_status result = _cmds_condition.wait_until(lock, until);
-      if (!_running) break;
+    async_calls(lock);
+
+    uint64_t now = real_time_ms();
+    while (_running && !_virtual_time && _wheel.now() < now) {
+      _wheel.skip_to(now - 1);
+      process_tick(lock);
     }
+    if (!_running || _virtual_time || !_funcs.empty()) continue;
 
-    async_calls();
-    trigger_timers();
+    uint64_t next = _wheel.next_event();
+    if (next == UINT64_MAX) next = now + 1000;
+    _condition.wait_until(lock, _epoch + std::chrono::milliseconds(next));
   }
 }
 
-void timer_queue::process_cmds()
+void timer_queue::process_tick(std::unique_lock<std::mutex>& lock)
 {
-  int added = 0;
-  while (!_cmds.empty()) {
-    timer_req_t req = _cmds.back();
-    _cmds.pop_back();
-
-    if (req.cmd == timer_req_t::cmd_pend_func) {
-      if (req.func_call.func) {
-        _funcs.emplace_back(std::move(req.func_call));
-      }
+  timer_handle_t* t = _wheel.tick();
+  if (!t) return;
+
+  std::vector<timer_handle_t*> expired;
+  while (t) {
+    timer_handle_t* next = t->next;
+    t->next = nullptr;
+    if (t->repeat) {
+      _wheel.add(t, t->expires + t->period);
     } else {
-      timer_handle_t *t = req.timer;
-      auto pos = std::find(_timers.begin(), _timers.end(), t);
-      switch (req.cmd) {
-      case timer_req_t::cmd_start:
-        t->next_trigger = _current_time + std::chrono::milliseconds(t->period);
-        t->active = true;
-        if (pos == _timers.end()) {
-          _timers.emplace_back(t);
-          added++;
-        }
-        break;
-
-      case timer_req_t::cmd_stop:
-        if (pos != _timers.end()) {
-          _timers.erase(pos);
-        }
-        break;
-
-      default:
-        break;
-      }
+      t->active = false;
     }
+    expired.push_back(t);
+    t = next;
+  }
+
+  lock.unlock();
+  for (auto t : expired) {
+    t->func(t);
   }
-  if (added) sort_timers();
+  lock.lock();
 }
 
-void timer_queue::trigger_timers() {
-  int triggered = 0;
-  for (auto t : _timers) {
-    if (t->next_trigger <= _current_time) {
-      if (t->repeat) {
-        t->next_trigger += std::chrono::milliseconds(t->period);
-      } else {
-        t->active = false;
-        stop_timer(t);
-      }
-      t->func(t);
-      triggered++;
-    } else {
-      break;
+void timer_queue::async_calls(std::unique_lock<std::mutex>& lock)
+{
+  while (!_funcs.empty()) {
+    std::vector<timer_async_call_t> funcs;
+    funcs.swap(_funcs);
+
+    lock.unlock();
+    for (auto f : funcs) {
+      f.func(f.param1, f.param2);
     }
+    lock.lock();
   }
-  if (triggered) sort_timers();
 }
 
-void timer_queue::async_calls() {
-  for (auto f : _funcs) {
-    f.func(f.param1, f.param2);
+void timer_queue::set_virtual_time(bool enable)
+{
+  {
+    std::lock_guard lock(_mutex);
+    if (_virtual_time == enable) return;
+    _virtual_time = enable;
+    _virtual_time_enabled = enable;
+
+    // back to real time: pending timers keep their remaining time
+    if (!enable) _wheel.rebase(real_time_ms());
   }
-  _funcs.clear();
+  _condition.notify_one();
+}
+
+void timer_queue::advance(uint32_t ms)
+{
+  std::unique_lock lock(_mutex);
+  if (!_virtual_time) return;
+
+  uint64_t target = _wheel.now() + ms;
+  async_calls(lock);
+  while (_wheel.now() < target) {
+    _wheel.skip_to(target - 1);
+    process_tick(lock);
+    async_calls(lock);
+  }
+}
+
+uint64_t timer_queue::get_time_ms()
+{
+  std::lock_guard lock(_mutex);
+  return _virtual_time ? _wheel.now() : real_time_ms();
 }
 
 int timer_create(timer_handle_t* h, timer_func_t func, const char* name,
@@ -217,7 +384,7 @@ int timer_stop(timer_handle_t* h)
 {
   if (!timer_is_created(h)) return -1;
   timer_queue::instance().stop_timer(h);
-  return 0; 
+  return 0;
 }
 
 int timer_set_period(timer_handle_t *h, unsigned period)
@@ -227,3 +394,23 @@ int timer_set_period(timer_handle_t *h, unsigned period)
   timer_queue::instance().start_timer(h);
   return 0;
 }
+
+void timer_set_virtual_time(bool enable)
+{
+  timer_queue::instance().set_virtual_time(enable);
+}
+
+bool timer_is_virtual_time()
+{
+  return _virtual_time_enabled;
+}
+
+void timer_advance_time(uint32_t ms)
+{
+  timer_queue::instance().advance(ms);
+}
+
+uint64_t timer_get_time_ms()
+{
+  return timer_queue::instance().get_time_ms();
+}
@@ -37,9 +37,24 @@ struct timer_handle_t {
   unsigned     period;
   bool         repeat;
 
-  time_point_t next_trigger;
+  // timer wheel slot (intrusive list)
+  uint64_t         expires;
+  timer_handle_t*  next;
+  timer_handle_t** pprev;
+
   std::atomic_bool active;
 };
 
 #define TIMER_INITIALIZER {0}
 
+// Virtual time (simulator and tests):
+//  when enabled, timers and async calls are not driven by the wall clock
+//  anymore, but only by timer_advance_time(), which runs them in the
+//  calling thread. Long scenarios can then be played faster than real time.
+void timer_set_virtual_time(bool enable);
+bool timer_is_virtual_time();
+void timer_advance_time(uint32_t ms);
+
+// Current timer time in ms (virtual or real)
+uint64_t timer_get_time_ms();
+
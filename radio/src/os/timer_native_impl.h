@@ -1,7 +1,6 @@
 #include "timer_native.h"
 
 #include <condition_variable>
-#include <deque>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -13,19 +12,52 @@ struct timer_async_call_t {
   uint32_t param2;
 };
 
-struct timer_req_t {
-  enum type {
-    cmd_start,
-    cmd_stop,
-    cmd_pend_func,
-  };
+// Hierarchical timing wheel:
+//
+//  - 4 levels of 64 slots, with 1ms resolution on the first level
+//    (64ms, 4s, 4min, 4.6h ranges).
+//  - each slot is an intrusive list of timers, so that starting or
+//    stopping a timer is O(1).
+//  - when the first level wraps around, the next slot of the upper
+//    level is cascaded down.
+//
+#define TIMER_WHEEL_BITS   6
+#define TIMER_WHEEL_SIZE   (1 << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_MASK   (TIMER_WHEEL_SIZE - 1)
+#define TIMER_WHEEL_LEVELS 4
+
+class timer_wheel {
+
+  timer_handle_t* _slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SIZE] = {};
+  uint64_t _now = 0;
+  unsigned _count = 0;
+
+  void link(timer_handle_t* t);
+  void unlink(timer_handle_t* t);
+  void cascade(unsigned level);
+  timer_handle_t* take_all();
 
-  type cmd;
+public:
+  uint64_t now() const { return _now; }
+  bool empty() const { return _count == 0; }
+
+  void add(timer_handle_t* t, uint64_t expires);
+  void remove(timer_handle_t* t);
+
+  // Set current time, keeping the remaining time of each timer
+  void rebase(uint64_t now);
+
+  // Remove all timers
+  void clear();
 
-  union {
-    timer_handle_t *timer;
-    timer_async_call_t func_call;
-  };
+  // Move forward by one tick and return expired timers (unlinked)
+  timer_handle_t* tick();
+
+  // Time of the next tick needing to be processed
+  uint64_t next_event() const;
+
+  // Skip ticks with nothing to process, up to 'now'
+  void skip_to(uint64_t now);
 };
 
 class timer_queue {
@@ -33,24 +65,22 @@ class timer_queue {
   std::unique_ptr<std::thread> _thread;
   bool _running = false;
 
-  std::deque<timer_req_t> _cmds;
-  std::mutex _cmds_mutex;
-  std::condition_variable _cmds_condition;
+  std::mutex _mutex;
+  std::condition_variable _condition;
 
-  std::vector<timer_handle_t*> _timers;
+  timer_wheel _wheel;
   std::vector<timer_async_call_t> _funcs;
 
-  time_point_t _current_time;
-  
+  // wheel time origin in real time mode
+  time_point_t _epoch;
+  bool _virtual_time = false;
+
   timer_queue();
 
-  void update_current_time();
-  void sort_timers();
+  uint64_t real_time_ms() const;
   void main_loop();
-  void trigger_timers();
-  void async_calls();
-  void process_cmds();
-  void send_cmd(timer_req_t&& req);
+  void process_tick(std::unique_lock<std::mutex>& lock);
+  void async_calls(std::unique_lock<std::mutex>& lock);
   void stop();
 
 public:
@@ -69,4 +99,9 @@ public:
   void stop_timer(timer_handle_t *timer);
 
   void pend_function(timer_async_func_t func, void* param1, uint32_t param2);
+
+  void set_virtual_time(bool enable);
+  bool is_virtual_time() const { return _virtual_time; }
+  void advance(uint32_t ms);
+  uint64_t get_time_ms();
 };
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#pragma once
+
+#include "edgetx.h"
+#include "crc.h"
+
+// Channels frame encoder
+//
+// Channel values are scaled according to the protocol format, then
+// packed LSB first with Format::BITS bits per channel directly into
+// the module buffer. The frame CRC (Crc8, Crc16 or ChannelsPxx2Crc) is
+// updated with each byte written, so that no second pass over the
+// buffer is needed.
+//
+// A format provides:
+//   - BITS: number of bits per channel
+//   - scale(value, offset): channel value [-1024:1024] + PPM center
+//     offset to protocol value
+//
+
+// PPM center offset of an output channel, in channel units
+inline int channelCenterOffset(uint8_t channel)
+{
+  return 2 * PPM_CH_CENTER(channel) - 2 * PPM_CENTER;
+}
+
+struct ChannelsNoCrc {
+  void update(uint8_t) {}
+};
+
+// PXX2 checksum (see Pxx2CrcMixin)
+struct ChannelsPxx2Crc {
+  uint16_t crc;
+  void update(uint8_t byte) { crc -= byte; }
+};
+
+template <class Format, class Crc = ChannelsNoCrc>
+class ChannelsEncoder
+{
+ public:
+  ChannelsEncoder(uint8_t*& ptr, Crc& crc) : ptr(ptr), crc(crc) {}
+
+  // Add one channel, scaled by the protocol format
+  void add(int value, int offset = 0)
+  {
+    addRaw(Format::scale(value, offset));
+  }
+
+  // Add one already scaled channel value (failsafe hold, etc)
+  void addRaw(uint32_t value)
+  {
+    bits |= value << bitsAvailable;
+    bitsAvailable += Format::BITS;
+    while (bitsAvailable >= 8) {
+      uint8_t byte = bits;
+      *ptr++ = byte;
+      crc.update(byte);
+      bits >>= 8;
+      bitsAvailable -= 8;
+    }
+  }
+
+  // Add 'count' channels, 'firstChannel' being the output channel
+  // used to fetch the PPM center offset of values[0]
+  void addChannels(const int16_t* values, uint8_t count, uint8_t firstChannel)
+  {
+    for (uint8_t i = 0; i < count; i++) {
+      add(values[i], channelCenterOffset(firstChannel + i));
+    }
+  }
+
+ protected:
+  uint8_t*& ptr;
+  Crc& crc;
+  uint32_t bits = 0;
+  uint8_t bitsAvailable = 0;
+};
+
+// Range for channels is [-1024:+1024] for [-100%;100%]
+
+// CRSF: 80% scale around 992
+struct CrossfireChannelsFormat {
+  static constexpr uint8_t BITS = 11;
+  static constexpr int CENTER = 0x3E0;
+
+  // the center offset is scaled on its own (+1 is for rounding)
+  static inline uint32_t scale(int value, int offset)
+  {
+    return limit(0, CENTER + ((offset + 1) * 4) / 5 + (value * 4) / 5,
+                 2 * CENTER);
+  }
+};
+
+// SBUS: 80% scale around 992
+struct SbusChannelsFormat {
+  static constexpr uint8_t BITS = 11;
+  static constexpr int CENTER = 992;
+
+  static inline uint32_t scale(int value, int offset)
+  {
+    return limit(0, (value + offset) * 8 / 10 + CENTER, 2047);
+  }
+};
+
+// Multi: [204;1843] as [-100%;100%]
+struct MultiChannelsFormat {
+  static constexpr uint8_t BITS = 11;
+
+  static inline uint32_t scale(int value, int offset)
+  {
+    return limit(0, (value + offset) * 800 / 1000 + 1024, 2047);
+  }
+};
+
+// Multi failsafe: 0 and 2047 are reserved for "no pulses" and "hold"
+struct MultiFailsafeFormat : public MultiChannelsFormat {
+  static inline uint32_t scale(int value, int offset)
+  {
+    return limit(1, (value + offset) * 800 / 1000 + 1024, 2046);
+  }
+};
+
+// PXX2: 12 bits, 0 and 2047 are reserved for "no pulses" and "hold"
+struct Pxx2ChannelsFormat {
+  static constexpr uint8_t BITS = 12;
+
+  static inline uint32_t scale(int value, int offset)
+  {
+    return limit(1, (value + offset) * 512 / 682 + 1024, 2046);
+  }
+};
@@ -30,15 +30,9 @@
 #include "hal/module_port.h"
 
 #include "crossfire.h"
+#include "channels_encoder.h"
 #include "telemetry/crossfire.h"
 
-#define CROSSFIRE_CH_BITS           11
-#define CROSSFIRE_CENTER            0x3E0
-#if defined(PPM_CENTER_ADJUSTABLE)
-  #define CROSSFIRE_CENTER_CH_OFFSET(ch)            ((2 * limitAddress(ch)->ppmCenter) + 1)  // + 1 is for rouding
-#else
-  #define CROSSFIRE_CENTER_CH_OFFSET(ch)            (0)
-#endif
 
 #define MIN_FRAME_LEN 3
 
@@ -108,28 +102,23 @@ uint8_t createCrossfireChannelsFrame(uint8_t moduleIdx, uint8_t * frame, int16_t
   uint8_t * buf = frame;
   *buf++ = MODULE_ADDRESS;
   *buf++ = 24 + lenAdjust;      // 1(ID) + 22(channel data) + (+1 extra byte if Switch mode) + 1(CRC)
-  uint8_t * crc_start = buf;
+
+  Crc8 crc;
   *buf++ = CHANNELS_ID;
-  uint32_t bits = 0;
-  uint8_t bitsavailable = 0;
-  for (int i=0; i<CROSSFIRE_CHANNELS_COUNT; i++) {
-    uint32_t val = limit(0, CROSSFIRE_CENTER + (CROSSFIRE_CENTER_CH_OFFSET(i) * 4) / 5 + (pulses[i] * 4) / 5, 2 * CROSSFIRE_CENTER);
-    bits |= val << bitsavailable;
-    bitsavailable += CROSSFIRE_CH_BITS;
-    while (bitsavailable >= 8) {
-      *buf++ = bits;
-      bits >>= 8;
-      bitsavailable -= 8;
-    }
-  }
-  
+  crc.update(CHANNELS_ID);
+
+  ChannelsEncoder<CrossfireChannelsFormat, Crc8> encoder(buf, crc);
+  encoder.addChannels(pulses, CROSSFIRE_CHANNELS_COUNT, 0);
+
   if (armingMode == ARMING_MODE_SWITCH) {
     swsrc_t sw =  md->crsf.crsfArmingTrigger;
 
-    *buf++ = (sw != SWSRC_NONE) && getSwitch(sw, 0);  // commanded armed status in Switch mode
+    uint8_t armed = (sw != SWSRC_NONE) && getSwitch(sw, 0);  // commanded armed status in Switch mode
+    *buf++ = armed;
+    crc.update(armed);
   }
-  
-  *buf++ = crc8(crc_start, 23 + lenAdjust);
+
+  *buf++ = crc.get();
   return buf - frame;
 }
 
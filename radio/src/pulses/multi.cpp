@@ -25,6 +25,7 @@
 #include "io/multi_protolist.h"
 #include "telemetry/multi.h"
 #include "mixer_scheduler.h"
+#include "channels_encoder.h"
 #include "hal/abnormal_reboot.h"
 
 // for the  MULTI protocol definition
@@ -36,7 +37,6 @@
 #define MULTI_SEND_AUTOBIND                 (1 << 6)
 
 #define MULTI_CHANS                         16
-#define MULTI_CHAN_BITS                     11
 
 #define MULTI_NORMAL   0x00
 #define MULTI_FAILSAFE 0x01
@@ -82,33 +82,23 @@ static void updateMultiSync(uint8_t module)
 
 static void sendFailsafeChannels(uint8_t*& p_buf, uint8_t module)
 {
-  uint32_t bits = 0;
-  uint8_t bitsavailable = 0;
+  ChannelsNoCrc crc;
+  ChannelsEncoder<MultiFailsafeFormat> encoder(p_buf, crc);
 
   for (int i = 0; i < MULTI_CHANS; i++) {
     int16_t failsafeValue = g_model.failsafeChannels[i];
-    int pulseValue;
 
     if (g_model.moduleData[module].failsafeMode == FAILSAFE_HOLD ||
         failsafeValue == FAILSAFE_CHANNEL_HOLD) {
-      pulseValue = 2047;
+      encoder.addRaw(2047);
     } else if (g_model.moduleData[module].failsafeMode ==
                    FAILSAFE_NOPULSES ||
                failsafeValue == FAILSAFE_CHANNEL_NOPULSE) {
-      pulseValue = 0;
+      encoder.addRaw(0);
     } else {
-      failsafeValue +=
-          2 * PPM_CH_CENTER(g_model.moduleData[module].channelsStart + i) -
-          2 * PPM_CENTER;
-      pulseValue = limit(1, (failsafeValue * 800 / 1000) + 1024, 2046);
-    }
-
-    bits |= pulseValue << bitsavailable;
-    bitsavailable += MULTI_CHAN_BITS;
-    while (bitsavailable >= 8) {
-      sendMulti(p_buf, (uint8_t) (bits & 0xff));
-      bits >>= 8;
-      bitsavailable -= 8;
+      encoder.add(failsafeValue,
+                  channelCenterOffset(
+                      g_model.moduleData[module].channelsStart + i));
     }
   }
 }
@@ -293,28 +283,14 @@ const etx_proto_driver_t MultiDriver = {
 
 static void sendChannels(uint8_t*& p_buf, uint8_t module)
 {
-  uint32_t bits = 0;
-  uint8_t bitsavailable = 0;
-
   // byte 4-25, channels 0..2047
   // Range for pulses (channelsOutputs) is [-1024:+1024] for [-100%;100%]
   // Multi uses [204;1843] as [-100%;100%]
-  for (int i = 0; i < MULTI_CHANS; i++) {
-    int channel = g_model.moduleData[module].channelsStart + i;
-    int value = channelOutputs[channel] + 2 * PPM_CH_CENTER(channel) - 2 * PPM_CENTER;
-
-    // Scale to 80%
-    value = value * 800 / 1000 + 1024;
-    value = limit(0, value, 2047);
-
-    bits |= value << bitsavailable;
-    bitsavailable += MULTI_CHAN_BITS;
-    while (bitsavailable >= 8) {
-      sendMulti(p_buf, (uint8_t) (bits & 0xff));
-      bits >>= 8;
-      bitsavailable -= 8;
-    }
-  }
+  uint8_t channel = g_model.moduleData[module].channelsStart;
+
+  ChannelsNoCrc crc;
+  ChannelsEncoder<MultiChannelsFormat> encoder(p_buf, crc);
+  encoder.addChannels(&channelOutputs[channel], MULTI_CHANS, channel);
 }
 
 void sendFrameProtocolHeader(uint8_t*& p_buf, uint8_t module, bool failsafe)
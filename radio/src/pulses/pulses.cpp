@@ -28,6 +28,7 @@
 #include "os/sleep.h"
 #include "tasks/mixer_task.h"
 #include "os/async.h"
+#include "latency_trace.h"
 
 #include "pulses/pxx2.h"
 #include "pulses/flysky.h"
@@ -560,6 +561,7 @@ void pulsesSendNextFrame(uint8_t module)
 
     auto buffer = _module_buffers[module]._buffer;
     drv->sendPulses(ctx, buffer, channels, nChannels);
+    LATENCY_TRACE_FRAME(module, protocol);
   }
 }
 
@@ -29,6 +29,7 @@
 
 #include "pxx2.h"
 #include "pxx2_transport.h"
+#include "channels_encoder.h"
 
 static const etx_serial_init pxx2SerialInitParams = {
     .baudrate = PXX2_HIGHSPEED_BAUDRATE,
@@ -267,70 +268,56 @@ void Pxx2Pulses::addFlag1(uint8_t module)
   Pxx2Transport::addByte(flag1);
 }
 
-void Pxx2Pulses::addPulsesValues(uint16_t low, uint16_t high)
-{
-  Pxx2Transport::addByte(low); // Low byte of channel
-  Pxx2Transport::addByte(((low >> 8u) & 0x0Fu) | (high << 4u));  // 4 bits each from 2 channels
-  Pxx2Transport::addByte(high >> 4u);  // High byte of channel
-}
-
 void Pxx2Pulses::addChannels(uint8_t module, int16_t* channels, uint8_t nChannels)
 {
-  uint16_t pulseValue = 0;
-  uint16_t pulseValueLow = 0;
-
   uint8_t channel = g_model.moduleData[module].channelsStart;
   uint8_t count = sentModuleChannels(module);
 
-  for (int8_t i = 0; i < count; i++, channel++) {
-    int value = channels[i] + 2*PPM_CH_CENTER(channel) - 2*PPM_CENTER;
-    pulseValue = limit(1, (value * 512 / 682) + 1024, 2046);
+  // 12 bits per channel, 3 bytes for 2 channels
+  ChannelsPxx2Crc crc = {Pxx2CrcMixin::crc};
+  ChannelsEncoder<Pxx2ChannelsFormat, ChannelsPxx2Crc> encoder(ptr, crc);
+
 #if defined(DEBUG_LATENCY_RF_ONLY)
-    if (latencyToggleSwitch)
-      pulseValue = 1;
-    else
-      pulseValue = 2046;
-#endif
-    if (i & 1)
-      addPulsesValues(pulseValueLow, pulseValue);
-    else
-      pulseValueLow = pulseValue;
+  for (int8_t i = 0; i < count; i++) {
+    encoder.addRaw(latencyToggleSwitch ? 1 : 2046);
   }
+#else
+  encoder.addChannels(channels, count, channel);
+#endif
+
+  Pxx2CrcMixin::crc = crc.crc;
 }
 
 void Pxx2Pulses::addFailsafe(uint8_t module)
 {
-  uint16_t pulseValue = 0;
-  uint16_t pulseValueLow = 0;
-
   uint8_t channel = g_model.moduleData[module].channelsStart;
   uint8_t count = sentModuleChannels(module);
 
+  ChannelsPxx2Crc crc = {Pxx2CrcMixin::crc};
+  ChannelsEncoder<Pxx2ChannelsFormat, ChannelsPxx2Crc> encoder(ptr, crc);
+
   for (int8_t i = 0; i < count; i++, channel++) {
     if (g_model.moduleData[module].failsafeMode == FAILSAFE_HOLD) {
-      pulseValue = 2047;
+      encoder.addRaw(2047);
     }
     else if (g_model.moduleData[module].failsafeMode == FAILSAFE_NOPULSES) {
-      pulseValue = 0;
+      encoder.addRaw(0);
     }
     else {
       int16_t failsafeValue = g_model.failsafeChannels[channel];
       if (failsafeValue == FAILSAFE_CHANNEL_HOLD) {
-        pulseValue = 2047;
+        encoder.addRaw(2047);
       }
       else if (failsafeValue == FAILSAFE_CHANNEL_NOPULSE) {
-        pulseValue = 0;
+        encoder.addRaw(0);
       }
       else {
-        failsafeValue += 2*PPM_CH_CENTER(channel) - 2*PPM_CENTER;
-        pulseValue = limit(1, (failsafeValue * 512 / 682) + 1024, 2046);
+        encoder.add(failsafeValue, channelCenterOffset(channel));
       }
     }
-    if (i & 1)
-      addPulsesValues(pulseValueLow, pulseValue);
-    else
-      pulseValueLow = pulseValue;
   }
+
+  Pxx2CrcMixin::crc = crc.crc;
 }
 
 void Pxx2Pulses::setupChannelsFrame(uint8_t module, int16_t* channels, uint8_t nChannels)
@@ -131,8 +131,6 @@ class Pxx2Pulses: public Pxx2Transport {
 
     void addFlag1(uint8_t module);
 
-    void addPulsesValues(uint16_t low, uint16_t high);
-
     void addChannels(uint8_t module, int16_t* channels, uint8_t nChannels);
 
     void addFailsafe(uint8_t module);
@@ -23,11 +23,11 @@
 #include "hal/module_port.h"
 #include "hal/serial_driver.h"
 #include "mixer_scheduler.h"
+#include "channels_encoder.h"
 
 #include "edgetx.h"
 
 #define SBUS_NORMAL_CHANS 16
-#define SBUS_CHAN_BITS    11
 
 /* Definitions from CleanFlight/BetaFlight */
 
@@ -37,8 +37,6 @@
 #define SBUS_FLAG_FAILSAFE_ACTIVE   (1 << 3)
 #define SBUS_FRAME_BEGIN_BYTE       0x0F
 
-#define SBUS_CHAN_CENTER            992
-
 static inline void sendByte(uint8_t*& p_buf, uint8_t b)
 {
   *p_buf++ = b;
@@ -60,21 +58,17 @@ static void setupPulsesSbus(uint8_t module, uint8_t*& p_buf)
   // Sync Byte
   sendByte(p_buf, SBUS_FRAME_BEGIN_BYTE);
 
-  uint32_t bits = 0;
-  uint8_t bitsavailable = 0;
-
   // byte 1-22, channels 0..2047, limits not really clear (B
-  for (int i=0; i<SBUS_NORMAL_CHANS; i++) {
-    int value = getChannelValue(module, i);
-
-    value =  value*8/10 + SBUS_CHAN_CENTER;
-    bits |= limit(0, value, 2047) << bitsavailable;
-    bitsavailable += SBUS_CHAN_BITS;
-    while (bitsavailable >= 8) {
-      sendByte(p_buf, (uint8_t) (bits & 0xff));
-      bits >>= 8;
-      bitsavailable -= 8;
-    }
+  ChannelsNoCrc crc;
+  ChannelsEncoder<SbusChannelsFormat> encoder(p_buf, crc);
+
+  uint8_t channel = g_model.moduleData[module].channelsStart;
+  uint8_t count = min<uint8_t>(SBUS_NORMAL_CHANS, MAX_OUTPUT_CHANNELS - channel);
+  encoder.addChannels(&channelOutputs[channel], count, channel);
+
+  // channels over the limit are sent centered
+  for (uint8_t i = count; i < SBUS_NORMAL_CHANS; i++) {
+    encoder.add(0);
   }
 
   // flags
@@ -22,6 +22,7 @@
 #include "edgetx.h"
 #include "os/sleep.h"
 #include "timers_driver.h"
+#include "hal/adc_driver.h"
 #include "tasks/mixer_task.h"
 #include "mixes.h"
 #include "switches.h"
@@ -54,6 +55,11 @@ void storageDirty(uint8_t msk)
   storageDirtyMsk |= msk;
   storageDirtyTime10ms = get_tmr10ms();
 
+  // ADC processing depends on both radio and model settings
+  adcInvalidatePipeline();
+  logicalSwitchesInvalidateOrder();
+  customFunctionsInvalidate();
+
 #if defined(RTC_BACKUP_RAM)
   rambackupDirtyMsk = storageDirtyMsk;
   rambackupDirtyTime10ms = storageDirtyTime10ms;
@@ -84,6 +90,9 @@ void preModelLoad()
 
 void postRadioSettingsLoad()
 {
+  adcInvalidatePipeline();
+  globalFunctionsContext.invalidate();
+
 #if LCD_W == 128
   // Prevent GVARS to be off when imported or manually modified yaml
   // Since there is no way to have those back
@@ -160,6 +169,9 @@ static void sanitizeMixerLines()
 
 void postModelLoad(bool alarms)
 {
+  adcInvalidatePipeline();
+  logicalSwitchesInvalidateOrder();
+
 #if defined(COLORLCD)
   if (g_model.topbarWidgetWidth[0] == 0) {
     // Set default width for top bar widgets
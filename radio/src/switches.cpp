@@ -21,6 +21,7 @@
 
 #include "hal/switch_driver.h"
 #include "hal/adc_driver.h"
+#include "hal/key_driver.h"
 #include "hal/rgbleds.h"
 
 #include "myeeprom.h"
@@ -659,6 +660,80 @@ DurationAndDelayProcessing:
   return result;
 }
 
+// One bit per positive switch source, for sources which cannot change
+// while the mixer runs: physical and multipos switches, trims, telemetry
+// streaming, sensors, radio activity and trainer. Logical switches and
+// flight modes are direct lookups already.
+static uint32_t switchesCache[(SWSRC_COUNT + 31) / 32];
+static bool switchesCacheValid = false;
+
+static inline bool isSwitchCached(uint16_t cs_idx)
+{
+  return (cs_idx >= SWSRC_FIRST_SWITCH && cs_idx <= SWSRC_LAST_TRIM) ||
+         (cs_idx >= SWSRC_TELEMETRY_STREAMING &&
+          cs_idx <= SWSRC_TRAINER_CONNECTED);
+}
+
+static inline void switchesCacheSet(uint16_t cs_idx)
+{
+  switchesCache[cs_idx / 32] |= 1u << (cs_idx % 32);
+}
+
+void switchesCacheUpdate()
+{
+  memclear(switchesCache, sizeof(switchesCache));
+
+  auto max_switches = switchGetMaxAllSwitches();
+  for (uint8_t i = 0; i < max_switches; i++) {
+    uint8_t positions;
+#if defined(FUNCTION_SWITCHES)
+    if (switchIsCustomSwitch(i)) {
+      positions = 1 << (g_model.cfsState(i) ? SWITCH_HW_DOWN : SWITCH_HW_UP);
+    } else
+#endif
+    if (SWITCH_EXISTS(i)) {
+      positions = 1 << switchGetPosition(i);
+      // Handle 2POS switch installed in 3POS slot
+      auto sw_cfg = g_model.getSwitchType(i);
+      if ((sw_cfg == SWITCH_2POS || sw_cfg == SWITCH_TOGGLE) &&
+          (positions & (1 << SWITCH_HW_MID)))
+        positions |= 1 << SWITCH_HW_DOWN;
+    } else {
+      continue;
+    }
+
+    for (uint8_t pos = 0; pos < 3; pos++) {
+      if (positions & (1 << pos))
+        switchesCacheSet(SWSRC_FIRST_SWITCH + i * 3 + pos);
+    }
+  }
+
+  for (uint8_t i = 0; i < MAX_XPOTS_POSITIONS; i++) {
+    if (POT_POSITION(i)) switchesCacheSet(SWSRC_FIRST_MULTIPOS_SWITCH + i);
+  }
+
+  for (uint8_t i = 0; i < keysGetMaxTrims() * 2; i++) {
+    uint8_t idx = (inputMappingConvertMode(i / 2) << 1) + (i & 1);
+    if (trimDown(idx)) switchesCacheSet(SWSRC_FIRST_TRIM + i);
+  }
+
+  if (TELEMETRY_STREAMING()) switchesCacheSet(SWSRC_TELEMETRY_STREAMING);
+
+  for (uint8_t i = 0; i < MAX_TELEMETRY_SENSORS; i++) {
+    if (!telemetryItems[i].isOld()) switchesCacheSet(SWSRC_FIRST_SENSOR + i);
+  }
+
+  if (inactivity.counter < 2) switchesCacheSet(SWSRC_RADIO_ACTIVITY);
+  if (isTrainerConnected()) switchesCacheSet(SWSRC_TRAINER_CONNECTED);
+
+  switchesCacheValid = true;
+}
+
+void switchesCacheInvalidate()
+{
+  switchesCacheValid = false;
+}
+
 bool getSwitch(swsrc_t swtch, uint8_t flags)
 {
   bool result;
@@ -668,7 +743,11 @@ bool getSwitch(swsrc_t swtch, uint8_t flags)
 
   uint16_t cs_idx = abs(swtch);
 
-  if (cs_idx == SWSRC_ONE) {
+  if (switchesCacheValid && !(flags & GETSWITCH_MIDPOS_DELAY) &&
+      isSwitchCached(cs_idx)) {
+    result = switchesCache[cs_idx / 32] & (1u << (cs_idx % 32));
+  }
+  else if (cs_idx == SWSRC_ONE) {
     result = !s_mixer_first_run_done;
   }
   else if (cs_idx == SWSRC_ON) {
@@ -754,12 +833,155 @@ uint8_t getXPotPosition(uint8_t idx)
 }
 
 
+// Logical switches evaluation order
+//
+// Switches are evaluated after the logical switches they depend on (AND
+// switch, boolean operands, or logical switch used as a source), so that
+// a chain of logical switches settles within a single mixer run.
+// Switches in a dependency cycle are evaluated last, in index order.
+// Empty slots are skipped.
+static_assert(MAX_LOGICAL_SWITCHES <= 64, "logical switches masks are 64 bits");
+
+static uint8_t lswEvalOrder[MAX_LOGICAL_SWITCHES];
+static uint8_t lswEvalCount = 0;
+static uint64_t lswCycles = 0;
+static bool lswEvalOrderValid = false;
+
+static inline uint64_t lswSwitchDependency(swsrc_t swtch)
+{
+  unsigned idx = abs(swtch);
+  if (idx >= SWSRC_FIRST_LOGICAL_SWITCH && idx <= SWSRC_LAST_LOGICAL_SWITCH)
+    return (uint64_t)1 << (idx - SWSRC_FIRST_LOGICAL_SWITCH);
+  return 0;
+}
+
+static inline uint64_t lswSourceDependency(mixsrc_t source)
+{
+  unsigned idx = abs(source);
+  if (idx >= MIXSRC_FIRST_LOGICAL_SWITCH && idx <= MIXSRC_LAST_LOGICAL_SWITCH)
+    return (uint64_t)1 << (idx - MIXSRC_FIRST_LOGICAL_SWITCH);
+  return 0;
+}
+
+static uint64_t lswDependencies(const LogicalSwitchData * ls)
+{
+  uint64_t deps = lswSwitchDependency(ls->andsw);
+
+  switch (lswFamily(ls->func)) {
+    case LS_FAMILY_BOOL:
+      deps |= lswSwitchDependency(ls->v1) | lswSwitchDependency(ls->v2);
+      break;
+    case LS_FAMILY_COMP:
+      deps |= lswSourceDependency(ls->v1) | lswSourceDependency(ls->v2);
+      break;
+    case LS_FAMILY_OFS:
+    case LS_FAMILY_DIFF:
+    case LS_FAMILY_RANGE:
+      deps |= lswSourceDependency(ls->v1);
+      break;
+    default:
+      // timer, sticky and edge states are updated in logicalSwitchesTimerTick()
+      break;
+  }
+
+  return deps;
+}
+
+static void compileLogicalSwitches()
+{
+  uint64_t deps[MAX_LOGICAL_SWITCHES];
+  uint64_t used = 0;
+
+  for (uint8_t idx = 0; idx < MAX_LOGICAL_SWITCHES; idx++) {
+    LogicalSwitchData * ls = lswAddress(idx);
+    if (ls->func == LS_FUNC_NONE) {
+      deps[idx] = 0;
+      // not evaluated anymore
+      for (uint8_t fm = 0; fm < MAX_FLIGHT_MODES; fm++) {
+        lswFm[fm].lsw[idx].state = 0;
+        LS_LAST_VALUE(fm, idx) = CS_LAST_VALUE_INIT;
+      }
+      continue;
+    }
+    used |= (uint64_t)1 << idx;
+    deps[idx] = lswDependencies(ls);
+  }
+
+  // empty slots are always false
+  for (uint8_t idx = 0; idx < MAX_LOGICAL_SWITCHES; idx++) {
+    deps[idx] &= used;
+  }
+
+  // Kahn's algorithm, in index order within each pass
+  uint64_t done = 0;
+  lswEvalCount = 0;
+  bool progress = true;
+  while (progress) {
+    progress = false;
+    for (uint8_t idx = 0; idx < MAX_LOGICAL_SWITCHES; idx++) {
+      uint64_t bit = (uint64_t)1 << idx;
+      if ((used & bit) && !(done & bit) && (deps[idx] & ~done) == 0) {
+        lswEvalOrder[lswEvalCount++] = idx;
+        done |= bit;
+        progress = true;
+      }
+    }
+  }
+
+  // whatever remains is in a cycle, or depends on one
+  lswCycles = 0;
+  if (done != used) {
+    uint64_t reach[MAX_LOGICAL_SWITCHES];
+    memcpy(reach, deps, sizeof(reach));
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      for (uint8_t idx = 0; idx < MAX_LOGICAL_SWITCHES; idx++) {
+        uint64_t r = reach[idx];
+        for (uint8_t dep = 0; dep < MAX_LOGICAL_SWITCHES; dep++) {
+          if (reach[idx] & ((uint64_t)1 << dep)) r |= reach[dep];
+        }
+        if (r != reach[idx]) {
+          reach[idx] = r;
+          changed = true;
+        }
+      }
+    }
+
+    for (uint8_t idx = 0; idx < MAX_LOGICAL_SWITCHES; idx++) {
+      uint64_t bit = (uint64_t)1 << idx;
+      if (!(used & bit) || (done & bit)) continue;
+      lswEvalOrder[lswEvalCount++] = idx;
+      if (reach[idx] & bit) {
+        TRACE("Logical switch L%d is in a dependency cycle", idx + 1);
+        lswCycles |= bit;
+      }
+    }
+  }
+
+  lswEvalOrderValid = true;
+}
+
+void logicalSwitchesInvalidateOrder()
+{
+  lswEvalOrderValid = false;
+}
+
+bool logicalSwitchIsInCycle(uint8_t idx)
+{
+  if (!lswEvalOrderValid) compileLogicalSwitches();
+  return lswCycles & ((uint64_t)1 << idx);
+}
+
 /**
   @brief Calculates new state of logical switches for mixerCurrentFlightMode
 */
 void evalLogicalSwitches(bool isCurrentFlightmode)
 {
-  for (unsigned int idx=0; idx<MAX_LOGICAL_SWITCHES; idx++) {
+  if (!lswEvalOrderValid) compileLogicalSwitches();
+
+  for (uint8_t i = 0; i < lswEvalCount; i++) {
+    uint8_t idx = lswEvalOrder[i];
     LogicalSwitchContext & context = lswFm[mixerCurrentFlightMode].lsw[idx];
     bool result = getLogicalSwitch(idx);
     if (isCurrentFlightmode) {
@@ -1139,6 +1361,7 @@ int16_t lswTimerValue(delayval_t val)
 void logicalSwitchesReset()
 {
   memset(lswFm, 0, sizeof(lswFm));
+  logicalSwitchesInvalidateOrder();
 
   for (uint8_t fm=0; fm<MAX_FLIGHT_MODES; fm++) {
     for (uint8_t i=0; i<MAX_LOGICAL_SWITCHES; i++) {
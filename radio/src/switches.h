@@ -45,6 +45,9 @@ int16_t lswTimerValue(delayval_t val);
 
 bool getLSStickyState(uint8_t idx);
 void evalLogicalSwitches(bool isCurrentFlightmode=true);
+// To be called when logical switches are modified
+void logicalSwitchesInvalidateOrder();
+bool logicalSwitchIsInCycle(uint8_t idx);
 void logicalSwitchesCopyState(uint8_t src, uint8_t dst);
 void logicalSwitchesReset();
 void logicalSwitchesTimerTick();
@@ -62,6 +65,11 @@ swsrc_t getMovedSwitch();
 
 #define GETSWITCH_MIDPOS_DELAY   1
 bool getSwitch(swsrc_t swtch, uint8_t flags=0);
+
+// Snapshot of the switches, trims and telemetry states used by
+// getSwitch() while the mixer runs (see evalMixes())
+void switchesCacheUpdate();
+void switchesCacheInvalidate();
 uint8_t getXPotPosition(uint8_t idx);
 
 div_t switchInfo(int switchPosition);
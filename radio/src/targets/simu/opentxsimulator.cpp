@@ -188,6 +188,9 @@ OpenTxSimulator::OpenTxSimulator() :
   tracebackDevices.clear();
   traceCallback = firmwareTraceCb;
 
+  // outputs snapshots are sent across threads
+  qRegisterMetaType<TxOutputs>();
+
   // When we create the simulator, we change the UART driver
   for (int i = 0; i < MAX_AUX_SERIAL; i++) {
     etx_serial_port_t * port = serialPorts[i];
@@ -803,53 +806,37 @@ void OpenTxSimulator::checkOutputsChanged()
   static TxOutputs lastOutputs;
   static size_t chansDim = DIM(channelOutputs);
   const static int16_t limit = 512 * 2;
+  TxOutputs outputs;
   qint32 tmpVal;
   uint8_t i, idx;
   const uint8_t phase = getFlightMode();  // edgetx.cpp
 
+  // values are published as a single snapshot instead of one queued
+  // signal per changed value
   for (i=0; i < chansDim; i++) {
-    if (lastOutputs.chans[i] != channelOutputs[i] || m_resetOutputsData) {
-      emit channelOutValueChange(i, channelOutputs[i], (g_model.extendedLimits ? limit * LIMIT_EXT_PERCENT / 100 : limit));
-      emit outputValueChange(OUTPUT_SRC_CHAN_OUT, i, channelOutputs[i]);
-      lastOutputs.chans[i] = channelOutputs[i];
-    }
-    if (lastOutputs.ex_chans[i] != ex_chans[i] || m_resetOutputsData) {
-      emit channelMixValueChange(i, ex_chans[i], limit * 2);
-      emit outputValueChange(OUTPUT_SRC_CHAN_MIX, i, ex_chans[i]);
-      lastOutputs.ex_chans[i] = ex_chans[i];
-    }
+    outputs.chans[i] = channelOutputs[i];
+    outputs.ex_chans[i] = ex_chans[i];
   }
+  outputs.chansLimit = g_model.extendedLimits ? limit * LIMIT_EXT_PERCENT / 100 : limit;
+  outputs.mixesLimit = limit * 2;
 
   for (i=0; i < MAX_LOGICAL_SWITCHES; i++) {
-    tmpVal = (qint32)GET_SWITCH_BOOL(SWSRC_FIRST_LOGICAL_SWITCH+i);
-    if (lastOutputs.vsw[i] != (bool)tmpVal || m_resetOutputsData) {
-      emit virtualSwValueChange(i, tmpVal);
-      emit outputValueChange(OUTPUT_SRC_VIRTUAL_SW, i, tmpVal);
-      lastOutputs.vsw[i] = tmpVal;
-    }
+    outputs.vsw[i] = GET_SWITCH_BOOL(SWSRC_FIRST_LOGICAL_SWITCH+i);
   }
 
   for (i=0; i < Board::TRIM_AXIS_COUNT; i++) {
     idx = inputMappingConvertMode(i);
-    tmpVal = getTrimValue(getTrimFlightMode(phase, idx), idx);
-    if (lastOutputs.trims[i] != tmpVal || m_resetOutputsData) {
-      emit trimValueChange(i, tmpVal);
-      emit outputValueChange(OUTPUT_SRC_TRIM_VALUE, i, tmpVal);
-      lastOutputs.trims[i] = tmpVal;
-    }
+    outputs.trims[i] = getTrimValue(getTrimFlightMode(phase, idx), idx);
   }
 
-  tmpVal = g_model.extendedTrims ? TRIM_EXTENDED_MAX : TRIM_MAX;
-  if (lastOutputs.trimRange != tmpVal || m_resetOutputsData) {
-    emit trimRangeChange(Board::TRIM_AXIS_COUNT, -tmpVal, tmpVal);
-    emit outputValueChange(OUTPUT_SRC_TRIM_RANGE, Board::TRIM_AXIS_COUNT, tmpVal);
-    lastOutputs.trimRange = tmpVal;
+  outputs.trimRange = g_model.extendedTrims ? TRIM_EXTENDED_MAX : TRIM_MAX;
+  if (lastOutputs.trimRange != outputs.trimRange || m_resetOutputsData) {
+    emit trimRangeChange(Board::TRIM_AXIS_COUNT, -outputs.trimRange, outputs.trimRange);
   }
 
+  outputs.phase = phase;
   if (lastOutputs.phase != phase || m_resetOutputsData) {
     emit phaseChanged(phase, getCurrentPhaseName());
-    emit outputValueChange(OUTPUT_SRC_PHASE, 0, qint16(phase));
-    lastOutputs.phase = phase;
   }
 
 #if defined(GVAR_VALUE) && defined(GVARS)
@@ -861,15 +848,19 @@ void OpenTxSimulator::checkOutputsChanged()
       gvar.mode = fm;
       gvar.value = (int16_t)GVAR_VALUE(gv, getGVarFlightMode(fm, gv));
       tmpVal = gvar;
+      outputs.gvars[fm][gv] = tmpVal;
       if (lastOutputs.gvars[fm][gv] != tmpVal || m_resetOutputsData) {
-        lastOutputs.gvars[fm][gv] = tmpVal;
         emit gVarValueChange(gv, tmpVal);
-        emit outputValueChange(OUTPUT_SRC_GVAR, gv, tmpVal);
       }
     }
   }
 #endif
 
+  if (memcmp(&lastOutputs, &outputs, sizeof(TxOutputs)) || m_resetOutputsData) {
+    emit outputsChanged(outputs);
+    lastOutputs = outputs;
+  }
+
   m_resetOutputsData = false;
 }
 
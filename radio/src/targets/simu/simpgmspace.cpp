@@ -24,6 +24,7 @@
 
 #include "edgetx.h"
 #include "simulcd.h"
+#include "latency_trace.h"
 
 #include "hal/adc_driver.h"
 #include "hal/rotary_encoder.h"
@@ -69,6 +70,9 @@ void lcdCopy(void * dest, void * src);
 
 uint64_t simuTimerMicros(void)
 {
+  // same time base as the timer queue (steady clock epoch)
+  if (timer_is_virtual_time()) return timer_get_time_ms() * 1000;
+
   auto now = std::chrono::steady_clock::now();
   return (uint64_t) std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
 }
@@ -201,6 +205,13 @@ extern task_handle_t menusTaskId;
 extern task_handle_t audioTaskId;
 #endif
 
+#if defined(LATENCY_TRACE)
+static void simuLatencyOutput(const char * line)
+{
+  TRACE("%s", line);
+}
+#endif
+
 void simuStop()
 {
   if (!simu_running)
@@ -209,6 +220,10 @@ void simuStop()
   simu_shutdown = true;
   task_shutdown_all();
 
+#if defined(LATENCY_TRACE)
+  latencyTraceReport(simuLatencyOutput);
+#endif
+
   simu_running = false;
 }
 
@@ -0,0 +1,450 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+// Headless simulator: replays an input script (and optionally a
+// telemetry capture) against a radio / model SD image, as fast as
+// possible, and dumps channel outputs, logical switches and audio
+// events to a text file.
+//
+// The mixer is stepped from the main thread every 10ms of virtual time,
+// so that a replay is fully deterministic.
+//
+// Input script, one event per line ('#' starts a comment):
+//   <ms> ana <index> <value>     analog input [-1024:1024]
+//   <ms> sw <index> <state>      switch state (-1, 0, 1)
+//   <ms> key <index> <0|1>       key
+//   <ms> trim <index> <0|1>      trim switch
+//   <ms> end                     end of the replay
+//
+// Telemetry capture, one frame per line:
+//   <ms> <int|ext> <sport|hub|hub-oob|crsf> <hex bytes>
+//
+// Output:
+//   <ms> CH <ch1> ... <chN>      every --interval ms
+//   <ms> LS <0|1 ...>            when any logical switch changes
+//   <ms> AUDIO file <filename>
+//   <ms> AUDIO tone <freq> <len>
+
+#include "edgetx.h"
+#include "simpgmspace.h"
+#include "switches.h"
+
+#include "hal/adc_driver.h"
+#include "os/timer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define REPLAY_TICK_MS 10
+
+static int16_t replayAnalogs[MAX_ANALOG_INPUTS];
+
+uint16_t simu_get_analog(uint8_t idx)
+{
+  // same scale as the companion simulator (see OpenTxSimulator)
+  if (IS_POT_MULTIPOS(idx - adcGetInputOffset(ADC_INPUT_FLEX))) {
+    StepsCalibData * calib = (StepsCalibData *) &g_eeGeneral.calib[idx];
+    int range6POS = 2048;
+    if (calib->count != 0) {
+      int c1 = calib->steps[calib->count - 1] * 32;
+      int c2 = calib->steps[calib->count - 2] * 32;
+      range6POS = c1 + (c1 - c2) / 2;
+    }
+    return (replayAnalogs[idx] * range6POS / 2048);
+  }
+  return (replayAnalogs[idx] * 2) + 2048;
+}
+
+struct ReplayEvent {
+  enum Type {
+    ANALOG,
+    SWITCH,
+    KEY,
+    TRIM,
+    TELEMETRY,
+    END,
+  };
+
+  uint32_t time;
+  Type type;
+  uint8_t index;   // input index, or telemetry module
+  int16_t value;   // input value, or telemetry protocol
+  std::vector<uint8_t> data;
+};
+
+enum {
+  REPLAY_TELEMETRY_SPORT,
+  REPLAY_TELEMETRY_HUB,
+  REPLAY_TELEMETRY_HUB_OOB,
+  REPLAY_TELEMETRY_CROSSFIRE,
+};
+
+static FILE * output = nullptr;
+static uint32_t replayTime = 0;
+
+static void audioTrace(const char * filename, uint16_t freq, uint16_t len)
+{
+  if (filename)
+    fprintf(output, "%u AUDIO file %s\n", replayTime, filename);
+  else
+    fprintf(output, "%u AUDIO tone %u %u\n", replayTime, freq, len);
+}
+
+static bool parseHex(const std::string & str, std::vector<uint8_t> & data)
+{
+  int nibbles = 0;
+  uint8_t byte = 0;
+  for (char c : str) {
+    if (isspace((unsigned char)c)) continue;
+    if (!isxdigit((unsigned char)c)) return false;
+    byte = (byte << 4) | (isdigit((unsigned char)c) ? c - '0' : (tolower(c) - 'a' + 10));
+    if (++nibbles == 2) {
+      data.push_back(byte);
+      nibbles = 0;
+      byte = 0;
+    }
+  }
+  return nibbles == 0 && !data.empty();
+}
+
+static bool parseInputLine(std::istringstream & line, ReplayEvent & event)
+{
+  std::string cmd;
+  line >> cmd;
+
+  int index = 0, value = 0;
+  if (cmd == "end") {
+    event.type = ReplayEvent::END;
+    return true;
+  }
+
+  if (!(line >> index >> value)) return false;
+  event.index = index;
+  event.value = value;
+
+  if (cmd == "ana") {
+    event.type = ReplayEvent::ANALOG;
+    return index < MAX_ANALOG_INPUTS;
+  }
+  if (cmd == "sw") {
+    event.type = ReplayEvent::SWITCH;
+    return true;
+  }
+  if (cmd == "key") {
+    event.type = ReplayEvent::KEY;
+    return index < MAX_KEYS;
+  }
+  if (cmd == "trim") {
+    event.type = ReplayEvent::TRIM;
+    return index < MAX_TRIMS * 2;
+  }
+  return false;
+}
+
+static bool parseTelemetryLine(std::istringstream & line, ReplayEvent & event)
+{
+  std::string module, protocol, hex;
+  line >> module >> protocol;
+  std::getline(line, hex);
+
+  event.type = ReplayEvent::TELEMETRY;
+
+  if (module == "int")
+    event.index = INTERNAL_MODULE;
+  else if (module == "ext")
+    event.index = EXTERNAL_MODULE;
+  else
+    return false;
+
+  if (protocol == "sport")
+    event.value = REPLAY_TELEMETRY_SPORT;
+  else if (protocol == "hub")
+    event.value = REPLAY_TELEMETRY_HUB;
+  else if (protocol == "hub-oob")
+    event.value = REPLAY_TELEMETRY_HUB_OOB;
+  else if (protocol == "crsf")
+    event.value = REPLAY_TELEMETRY_CROSSFIRE;
+  else
+    return false;
+
+  return parseHex(hex, event.data);
+}
+
+static bool loadEvents(const char * filename, bool telemetry,
+                       std::vector<ReplayEvent> & events)
+{
+  std::ifstream file(filename);
+  if (!file) {
+    fprintf(stderr, "Cannot open %s\n", filename);
+    return false;
+  }
+
+  std::string str;
+  unsigned lineNumber = 0;
+  while (std::getline(file, str)) {
+    lineNumber++;
+    auto comment = str.find('#');
+    if (comment != std::string::npos) str.erase(comment);
+
+    std::istringstream line(str);
+    ReplayEvent event = {};
+    if (!(line >> event.time)) {
+      if (line.eof()) continue;  // empty line
+    }
+    else if (telemetry ? parseTelemetryLine(line, event)
+                       : parseInputLine(line, event)) {
+      events.push_back(std::move(event));
+      continue;
+    }
+
+    fprintf(stderr, "%s:%u: invalid line\n", filename, lineNumber);
+    return false;
+  }
+
+  return true;
+}
+
+static void processTelemetry(const ReplayEvent & event)
+{
+  // same entry points as OpenTxSimulator::sendTelemetry()
+  uint8_t * data = (uint8_t *)event.data.data();
+  uint8_t len = std::min<size_t>(event.data.size(), 255);
+
+  switch (event.value) {
+    case REPLAY_TELEMETRY_SPORT:
+      sportProcessTelemetryPacket(event.index, data, len);
+      break;
+    case REPLAY_TELEMETRY_HUB:
+      frskyDProcessPacket(event.index, data, len);
+      break;
+    case REPLAY_TELEMETRY_HUB_OOB:
+      if (len >= 3) processHubPacket(data[0], (data[2] << 8) + data[1]);
+      break;
+    case REPLAY_TELEMETRY_CROSSFIRE:
+      processCrossfireTelemetryFrame(event.index, data, len);
+      break;
+  }
+}
+
+static void processEvent(const ReplayEvent & event)
+{
+  switch (event.type) {
+    case ReplayEvent::ANALOG:
+      replayAnalogs[event.index] = event.value;
+      break;
+    case ReplayEvent::SWITCH:
+      simuSetSwitch(event.index, event.value);
+      break;
+    case ReplayEvent::KEY:
+      simuSetKey(event.index, event.value);
+      break;
+    case ReplayEvent::TRIM:
+      simuSetTrim(event.index, event.value);
+      break;
+    case ReplayEvent::TELEMETRY:
+      processTelemetry(event);
+      break;
+    case ReplayEvent::END:
+      break;
+  }
+}
+
+static void dumpChannels()
+{
+  fprintf(output, "%u CH", replayTime);
+  for (uint8_t i = 0; i < MAX_OUTPUT_CHANNELS; i++) {
+    fprintf(output, " %d", channelOutputs[i]);
+  }
+  fprintf(output, "\n");
+}
+
+static void dumpLogicalSwitches(bool force)
+{
+  static char last[MAX_LOGICAL_SWITCHES + 1];
+  char current[MAX_LOGICAL_SWITCHES + 1];
+
+  for (uint8_t i = 0; i < MAX_LOGICAL_SWITCHES; i++) {
+    current[i] = getSwitch(SWSRC_FIRST_LOGICAL_SWITCH + i) ? '1' : '0';
+  }
+  current[MAX_LOGICAL_SWITCHES] = '\0';
+
+  if (force || memcmp(current, last, sizeof(current))) {
+    fprintf(output, "%u LS %s\n", replayTime, current);
+    memcpy(last, current, sizeof(current));
+  }
+}
+
+static void printUsage(const char * progname)
+{
+  printf("usage: %s --storage path --script file --output file "
+         "[--settings path] [--model file] [--telemetry file] "
+         "[--duration ms] [--interval ms]\n",
+         progname);
+  printf("\nOptions:\n");
+  printf("  --storage path     SD card image directory\n");
+  printf("  --settings path    Radio settings directory\n");
+  printf("  --model file       Model file to load (default: current model)\n");
+  printf("  --script file      Input script\n");
+  printf("  --telemetry file   Telemetry capture\n");
+  printf("  --duration ms      Replay duration (default: until last event)\n");
+  printf("  --interval ms      Channels dump interval (default: 100ms)\n");
+  printf("  --output file      Output file\n");
+}
+
+int main(int argc, char * argv[])
+{
+  const char * storagePath = nullptr;
+  const char * settingsPath = nullptr;
+  const char * modelFile = nullptr;
+  const char * scriptFile = nullptr;
+  const char * telemetryFile = nullptr;
+  const char * outputFile = nullptr;
+  long duration = -1;
+  long interval = 100;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "-h" || arg == "--help") {
+      printUsage(argv[0]);
+      return 0;
+    }
+    if (i + 1 >= argc) {
+      printUsage(argv[0]);
+      return 1;
+    }
+    const char * value = argv[++i];
+    if (arg == "--storage")
+      storagePath = value;
+    else if (arg == "--settings")
+      settingsPath = value;
+    else if (arg == "--model")
+      modelFile = value;
+    else if (arg == "--script")
+      scriptFile = value;
+    else if (arg == "--telemetry")
+      telemetryFile = value;
+    else if (arg == "--output")
+      outputFile = value;
+    else if (arg == "--duration")
+      duration = strtol(value, nullptr, 10);
+    else if (arg == "--interval")
+      interval = strtol(value, nullptr, 10);
+    else {
+      printf("Unknown option: %s\n", arg.c_str());
+      printUsage(argv[0]);
+      return 1;
+    }
+  }
+
+  // traces are printed on stdout
+  if (!storagePath || !scriptFile || !outputFile ||
+      interval < REPLAY_TICK_MS) {
+    printUsage(argv[0]);
+    return 1;
+  }
+
+  std::vector<ReplayEvent> events;
+  if (!loadEvents(scriptFile, false, events)) return 1;
+  if (telemetryFile && !loadEvents(telemetryFile, true, events)) return 1;
+
+  // inputs first for events at the same time
+  std::stable_sort(events.begin(), events.end(),
+                   [](const ReplayEvent & a, const ReplayEvent & b) {
+                     return a.time < b.time;
+                   });
+
+  if (duration < 0) {
+    duration = events.empty() ? 0 : events.back().time;
+    for (const auto & event : events) {
+      if (event.type == ReplayEvent::END) {
+        duration = event.time;
+        break;
+      }
+    }
+  }
+
+  output = fopen(outputFile, "w");
+  if (!output) {
+    fprintf(stderr, "Cannot open %s\n", outputFile);
+    return 1;
+  }
+
+  // timers and async calls only run when the replay advances
+  timer_set_virtual_time(true);
+
+  simuInit();
+  simuFatfsSetPaths(storagePath, settingsPath);
+
+#if !defined(COLORLCD)
+  menuLevel = 0;
+#endif
+
+  // see simuStart()
+  g_tmr10ms = 1;
+
+  sdInit();
+
+  // storageReadAll() would wait for a key press on missing settings
+  const char * error = loadRadioSettings();
+  if (error) {
+    fprintf(stderr, "Cannot load radio settings: %s\n", error);
+    return 1;
+  }
+  storageReadAll();
+
+  if (modelFile) {
+    char filename[LEN_MODEL_FILENAME + 1];
+    strncpy(filename, modelFile, LEN_MODEL_FILENAME);
+    filename[LEN_MODEL_FILENAME] = '\0';
+    error = loadModel(filename, false);
+    if (error) {
+      fprintf(stderr, "Cannot load model %s: %s\n", modelFile, error);
+      return 1;
+    }
+  }
+
+  simuAudioTraceCb = audioTrace;
+
+  auto event = events.begin();
+  for (replayTime = 0; replayTime <= (uint32_t)duration;
+       replayTime += REPLAY_TICK_MS) {
+    while (event != events.end() && event->time <= replayTime) {
+      processEvent(*event++);
+    }
+
+    per10ms();
+    doMixerCalculations();
+    doMixerPeriodicUpdates();
+    timer_advance_time(REPLAY_TICK_MS);
+
+    if (replayTime % interval == 0) dumpChannels();
+    dumpLogicalSwitches(replayTime == 0);
+  }
+
+  simuAudioTraceCb = nullptr;
+
+  fclose(output);
+  return 0;
+}
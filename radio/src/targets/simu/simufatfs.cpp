@@ -31,7 +31,10 @@
 #include <filesystem>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace fs = std::filesystem;
 
@@ -84,12 +87,62 @@ static bool redirectToSettingsDirectory(const fs::path& p)
   return starts_with(p.generic_string(), MODELS_PATH) || starts_with(p.generic_string(), RADIO_PATH);
 }
 
+// Directory listings used for case insensitive lookups. A listing is
+// reloaded when the directory modification time changes, so that files
+// added or removed outside of the simulator are still found.
+struct DirListing {
+  bool valid = false;
+  ftime_type mtime;
+  std::unordered_set<std::string> names;
+  std::unordered_map<std::string, std::string> lowerNames;
+};
+
+static std::unordered_map<std::string, DirListing> dirListings;
+static std::mutex dirListingsMutex;
+
+static const DirListing* getDirListing(const fs::path& dir)
+{
+  std::error_code ec;
+  auto mtime = fs::last_write_time(dir, ec);
+  if (ec) {
+    dirListings.erase(dir.string());
+    return nullptr;
+  }
+
+  auto& listing = dirListings[dir.string()];
+  if (listing.valid && listing.mtime == mtime) return &listing;
+
+  listing.names.clear();
+  listing.lowerNames.clear();
+  for (const auto& entry : fs::directory_iterator(dir, ec)) {
+    std::string name = entry.path().filename().string();
+    listing.lowerNames.emplace(to_lower(name), name);
+    listing.names.emplace(std::move(name));
+  }
+
+  if (ec) {
+    dirListings.erase(dir.string());
+    return nullptr;
+  }
+
+  listing.mtime = mtime;
+  listing.valid = true;
+  return &listing;
+}
+
+// Drop the listing of the directory containing 'path'
+static void invalidateDirListing(const fs::path& path)
+{
+  std::lock_guard<std::mutex> lock(dirListingsMutex);
+  dirListings.erase(path.parent_path().string());
+}
+
 static fs::path resolveCaseInsensitivePath(
     const fs::path& base,
     const fs::path& relativePath)
 {
   fs::path current = base;
-  std::error_code ec;
+  std::lock_guard<std::mutex> lock(dirListingsMutex);
 
   for (const auto& component : relativePath) {
     std::string componentStr = component.string();
@@ -100,32 +153,24 @@ static fs::path resolveCaseInsensitivePath(
       continue;
     }
 
-    // Try exact match first
-    fs::path exactPath = current / component;
-    if (fs::exists(exactPath, ec) && !ec) {
-      current = exactPath;
-      continue;
-    }
-
-    // Look for case-insensitive match
-    bool found = false;
-    if (fs::is_directory(current, ec) && !ec) {
-      std::string componentLower = to_lower(componentStr);
-
-      for (const auto& entry : fs::directory_iterator(current, ec)) {
-        if (ec) break;
+    const DirListing* listing = getDirListing(current);
+    if (listing) {
+      // Try exact match first
+      if (listing->names.count(componentStr)) {
+        current /= component;
+        continue;
+      }
 
-        std::string entryName = entry.path().filename().string();
-        if (to_lower(entryName) == componentLower) {
-          current = entry.path();
-          found = true;
-          break;
-        }
+      // Look for case-insensitive match
+      auto it = listing->lowerNames.find(to_lower(componentStr));
+      if (it != listing->lowerNames.end()) {
+        current /= it->second;
+        continue;
       }
     }
 
     // If not found, use original component name (file doesn't exist)
-    if (!found) current /= component;
+    current /= component;
   }
 
   return current;
@@ -164,6 +209,9 @@ void simuFatfsSetPaths(const char* sdPath, const char* settingsPath)
     simuSettingsDirectory =
         fs::path{settingsPath}.lexically_normal();
   }
+
+  std::lock_guard<std::mutex> lock(dirListingsMutex);
+  dirListings.clear();
 }
 
 std::string simuFatfsGetCurrentPath() { return simuCurrentPath.string(); }
@@ -289,6 +337,8 @@ FRESULT f_open(FIL* fil, const TCHAR* name, BYTE flag)
   try {
     auto simuFil = new _simu_FIL(realPath, mode);
     if (simuFil->stream->is_open()) {
+      // the file might have been created
+      if (flag & FA_WRITE) invalidateDirListing(realPath);
       fil->obj.fs = reinterpret_cast<FATFS*>(simuFil);
       return FR_OK;
     } else {
@@ -510,6 +560,7 @@ FRESULT f_mkdir(const TCHAR* name)
   std::error_code ec;
 
   bool created = fs::create_directory(path, ec);
+  invalidateDirListing(path);
   if (ec) return FR_INVALID_NAME;
 
   return created ? FR_OK : FR_EXIST;
@@ -521,6 +572,7 @@ FRESULT f_unlink(const TCHAR * name)
   std::error_code ec;
 
   bool removed = fs::remove(path, ec);
+  invalidateDirListing(path);
   if (ec) return FR_INVALID_NAME;
 
   return removed ? FR_OK : FR_INVALID_NAME;
@@ -533,6 +585,8 @@ FRESULT f_rename(const TCHAR *oldname, const TCHAR *newname)
   std::error_code ec;
 
   fs::rename(old.c_str(), path.c_str(), ec);
+  invalidateDirListing(old);
+  invalidateDirListing(path);
   if (ec) return FR_INVALID_NAME;
 
   return FR_OK;
@@ -21,6 +21,8 @@
 
 #include "timers_driver.h"
 
+extern uint64_t simuTimerMicros(void);
+
 void watchdogSuspend(unsigned int) {}
-uint32_t timersGetUsTick() { return 0; }
+uint32_t timersGetUsTick() { return (uint32_t)simuTimerMicros(); }
 
@@ -27,6 +27,7 @@
 
 #include "edgetx.h"
 #include "switches.h"
+#include "latency_trace.h"
 #include "hal/usb_driver.h"
 
 #include "hal/watchdog_driver.h"
@@ -247,6 +248,7 @@ void doMixerCalculations()
   DEBUG_TIMER_START(debugTimerEvalMixes);
   evalMixes(tick10ms);
   DEBUG_TIMER_STOP(debugTimerEvalMixes);
+  LATENCY_TRACE_STAGE(LATENCY_STAGE_MIXER);
 
 #if defined(HALL_SYNC) && !defined(SIMU)
   gpio_clear(HALL_SYNC);
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include <chrono>
+#include <vector>
+
+#include "gtests.h"
+#include "crc.h"
+
+static const uint8_t check_string[] = {'1', '2', '3', '4', '5',
+                                       '6', '7', '8', '9'};
+
+// byte-wise reference implementation
+static uint16_t crc16_ref(uint8_t index, const uint8_t* buf, uint32_t len,
+                          uint16_t crc)
+{
+  while (len--) {
+    crc = (crc << 8) ^ crc16tab[index][((crc >> 8) ^ *buf++) & 0xFF];
+  }
+  return crc;
+}
+
+TEST(Crc, checkValues)
+{
+  // CRC-16/XMODEM
+  EXPECT_EQ(0x31C3, crc16(CRC_1021, check_string, sizeof(check_string)));
+  // CRC-8/DVB-S2
+  EXPECT_EQ(0xBC, crc8(check_string, sizeof(check_string)));
+}
+
+TEST(Crc, crc16Slices)
+{
+  uint8_t buffer[1031];
+  for (unsigned i = 0; i < sizeof(buffer); i++) {
+    buffer[i] = (i * 7919) >> 3;
+  }
+
+  for (uint8_t index : {CRC_1021, CRC_1189}) {
+    // all lengths and alignments around the 4 bytes blocks
+    for (uint32_t offset = 0; offset < 4; offset++) {
+      for (uint32_t len = 0; len < 16; len++) {
+        EXPECT_EQ(crc16_ref(index, buffer + offset, len, 0xFFFF),
+                  crc16(index, buffer + offset, len, 0xFFFF));
+      }
+    }
+    EXPECT_EQ(crc16_ref(index, buffer, sizeof(buffer), 0),
+              crc16(index, buffer, sizeof(buffer)));
+  }
+}
+
+TEST(Crc, incremental)
+{
+  uint8_t buffer[257];
+  for (unsigned i = 0; i < sizeof(buffer); i++) {
+    buffer[i] = i ^ 0x5A;
+  }
+
+  Crc16 crc(CRC_1021, 0xFFFF);
+  crc.update(buffer, 100);
+  crc.update(buffer[100]);
+  crc.update(buffer + 101, sizeof(buffer) - 101);
+  EXPECT_EQ(crc16(CRC_1021, buffer, sizeof(buffer), 0xFFFF), crc.get());
+
+  Crc8 crc_d5;
+  crc_d5.update(buffer, 10);
+  crc_d5.update(buffer[10]);
+  EXPECT_EQ(crc8(buffer, 11), crc_d5.get());
+
+  Crc8 crc_ba(crc8tab_BA);
+  crc_ba.update(buffer, 11);
+  EXPECT_EQ(crc8_BA(buffer, 11), crc_ba.get());
+}
+
+// Throughput per polynom, run with --gtest_also_run_disabled_tests
+TEST(Crc, DISABLED_benchmark)
+{
+  std::vector<uint8_t> buffer(1024 * 1024);
+  for (size_t i = 0; i < buffer.size(); i++) {
+    buffer[i] = i * 31;
+  }
+
+  auto measure = [&](const char* name, auto fct) {
+    auto start = std::chrono::steady_clock::now();
+    uint32_t result = 0;
+    for (int i = 0; i < 16; i++) result += fct();
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    printf("%-12s %8.1f MB/s (%x)\n", name, 16 / elapsed.count(), result);
+  };
+
+  measure("crc16 1021", [&]() {
+    return crc16(CRC_1021, buffer.data(), buffer.size());
+  });
+  measure("crc16 1189", [&]() {
+    return crc16(CRC_1189, buffer.data(), buffer.size());
+  });
+  measure("crc16 ref", [&]() {
+    return crc16_ref(CRC_1021, buffer.data(), buffer.size(), 0);
+  });
+  measure("crc8 D5", [&]() { return crc8(buffer.data(), buffer.size()); });
+  measure("crc8 BA", [&]() { return crc8_BA(buffer.data(), buffer.size()); });
+}
@@ -26,7 +26,8 @@
 #if defined(CROSSFIRE)
 
 uint8_t createCrossfireChannelsFrame(uint8_t moduleIdx, uint8_t * frame, int16_t * pulses);
-TEST(Crossfire, createCrossfireChannelsFrame)
+class CrossfireTest : public EdgeTxTest {};
+TEST_F(CrossfireTest, createCrossfireChannelsFrame)
 {
   int16_t pulsesStart[MAX_TRAINER_CHANNELS];
   uint8_t crossfire[CROSSFIRE_FRAME_MAXLEN];
@@ -36,9 +37,30 @@ TEST(Crossfire, createCrossfireChannelsFrame)
     pulsesStart[i] = -1024 + (2048 / MAX_TRAINER_CHANNELS) * i;
   }
 
-  createCrossfireChannelsFrame(EXTERNAL_MODULE, crossfire, pulsesStart);
+  const uint8_t expected[] = {
+      0xEE, 0x18, 0x16, 0xAD, 0xA0, 0x88, 0x5E, 0xC0, 0x73, 0xA4, 0x56,
+      0x51, 0x4C, 0x6F, 0xE0, 0x33, 0x22, 0x2B, 0x27, 0x9A, 0x57, 0xF0,
+      0x1A, 0x99, 0xD5, 0x5B,
+  };
+
+  EXPECT_EQ(sizeof(expected), createCrossfireChannelsFrame(
+                                  EXTERNAL_MODULE, crossfire, pulsesStart));
+  EXPECT_EQ(0, memcmp(expected, crossfire, sizeof(expected)));
 
-  // TODO check
+  // Channels are clipped
+  for (int i=0; i<MAX_TRAINER_CHANNELS; i++) {
+    pulsesStart[i] = -1280 + 171 * i;
+  }
+
+  const uint8_t expected_clipped[] = {
+      0xEE, 0x18, 0x16, 0x00, 0x48, 0x83, 0x3C, 0xF6, 0x42, 0x20, 0x46,
+      0x55, 0xCC, 0x73, 0x26, 0x7C, 0x25, 0x4E, 0x81, 0x9B, 0x64, 0x69,
+      0x6F, 0x1D, 0xF8, 0x89,
+  };
+
+  createCrossfireChannelsFrame(EXTERNAL_MODULE, crossfire, pulsesStart);
+  EXPECT_EQ(0, memcmp(expected_clipped, crossfire, sizeof(expected_clipped)));
+  EXPECT_EQ(crc8(&crossfire[2], crossfire[1] - 1), crossfire[crossfire[1] + 1]);
 }
 
 TEST(Crossfire, crc8)
@@ -132,3 +132,50 @@ TEST_F(SpecialFunctionsTest, GvarsInc)
   EXPECT_EQ(g_model.flightModeData[0].gvars[0], 28);
 }
 #endif // #if defined(GVARS)
+
+#if defined(OVERRIDE_CHANNEL_FUNCTION)
+TEST_F(SpecialFunctionsTest, OverrideChannels)
+{
+  int sw;
+  for (sw = 0; sw < switchGetMaxAllSwitches(); sw += 1)
+    if (g_model.getSwitchType(sw) == SWITCH_3POS)
+      break;
+  int swPos = (sw * 3) + SWSRC_FIRST_SWITCH;
+
+  // two functions sharing the same trigger, one slot left empty
+  g_model.customFn[0].swtch = swPos;
+  g_model.customFn[0].func = FUNC_OVERRIDE_CHANNEL;
+  g_model.customFn[0].all.param = 2;
+  g_model.customFn[0].all.val = 50;
+  g_model.customFn[0].active = true;
+  g_model.customFn[2].swtch = swPos;
+  g_model.customFn[2].func = FUNC_OVERRIDE_CHANNEL;
+  g_model.customFn[2].all.param = 5;
+  g_model.customFn[2].all.val = -20;
+  g_model.customFn[2].active = true;
+
+  simuSetSwitch(sw, 0);
+  evalFunctions(g_model.customFn, modelFunctionsContext);
+  for (int i = 0; i < MAX_OUTPUT_CHANNELS; i++)
+    EXPECT_EQ(safetyCh[i], OVERRIDE_CHANNEL_UNDEFINED);
+
+  simuSetSwitch(sw, -1);
+  evalFunctions(g_model.customFn, modelFunctionsContext);
+  EXPECT_EQ(safetyCh[2], 50);
+  EXPECT_EQ(safetyCh[5], -20);
+  EXPECT_EQ(modelFunctionsContext.activeSwitches, (MASK_CFN_TYPE)0x05);
+
+  // the functions table is only rebuilt once invalidated
+  g_model.customFn[2].active = false;
+  customFunctionsInvalidate();
+  evalFunctions(g_model.customFn, modelFunctionsContext);
+  EXPECT_EQ(safetyCh[2], 50);
+  EXPECT_EQ(safetyCh[5], OVERRIDE_CHANNEL_UNDEFINED);
+  EXPECT_EQ(modelFunctionsContext.activeSwitches, (MASK_CFN_TYPE)0x01);
+
+  simuSetSwitch(sw, 0);
+  evalFunctions(g_model.customFn, modelFunctionsContext);
+  EXPECT_EQ(safetyCh[2], OVERRIDE_CHANNEL_UNDEFINED);
+  EXPECT_EQ(modelFunctionsContext.activeSwitches, (MASK_CFN_TYPE)0);
+}
+#endif
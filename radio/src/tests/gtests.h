@@ -98,6 +98,7 @@ inline void MIXER_RESET()
   mixerCurrentFlightMode = lastFlightMode = 0;
   lastAct = 0;
   logicalSwitchesReset();
+  customFunctionsReset();
 }
 
 inline void TELEMETRY_RESET()
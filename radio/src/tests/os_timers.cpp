@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "gtests.h"
+#include "os/async.h"
+#include "os/timer.h"
+
+static unsigned timerCalls[4];
+static uint64_t timerLastCall[4];
+
+static void timerCallback(timer_handle_t* h)
+{
+  unsigned idx = (uintptr_t)h->name;
+  timerCalls[idx]++;
+  timerLastCall[idx] = timer_get_time_ms();
+}
+
+static uint32_t asyncValue;
+
+static void asyncCallback(void*, uint32_t value) { asyncValue = value; }
+
+class OsTimersTest : public testing::Test
+{
+ protected:
+  timer_handle_t timers[4] = {TIMER_INITIALIZER, TIMER_INITIALIZER,
+                              TIMER_INITIALIZER, TIMER_INITIALIZER};
+
+  void SetUp() override
+  {
+    memclear(timerCalls, sizeof(timerCalls));
+    memclear(timerLastCall, sizeof(timerLastCall));
+    timer_set_virtual_time(true);
+  }
+
+  void TearDown() override
+  {
+    for (auto& t : timers) timer_stop(&t);
+    timer_set_virtual_time(false);
+  }
+
+  void create(unsigned idx, unsigned period, bool repeat)
+  {
+    timer_create(&timers[idx], timerCallback, (const char*)(uintptr_t)idx,
+                 period, repeat);
+  }
+};
+
+TEST_F(OsTimersTest, repeat)
+{
+  create(0, 10, true);
+  timer_start(&timers[0]);
+  EXPECT_TRUE(timer_is_active(&timers[0]));
+
+  uint64_t start = timer_get_time_ms();
+  timer_advance_time(1000);
+  EXPECT_EQ(start + 1000, timer_get_time_ms());
+  EXPECT_EQ(100U, timerCalls[0]);
+  EXPECT_EQ(start + 1000, timerLastCall[0]);
+
+  timer_stop(&timers[0]);
+  EXPECT_FALSE(timer_is_active(&timers[0]));
+  timer_advance_time(1000);
+  EXPECT_EQ(100U, timerCalls[0]);
+}
+
+TEST_F(OsTimersTest, oneShot)
+{
+  create(0, 50, false);
+  timer_start(&timers[0]);
+
+  uint64_t start = timer_get_time_ms();
+  timer_advance_time(49);
+  EXPECT_EQ(0U, timerCalls[0]);
+  timer_advance_time(500);
+  EXPECT_EQ(1U, timerCalls[0]);
+  EXPECT_EQ(start + 50, timerLastCall[0]);
+  EXPECT_FALSE(timer_is_active(&timers[0]));
+}
+
+TEST_F(OsTimersTest, longPeriods)
+{
+  // one timer per wheel level, and one above the wheel range
+  const unsigned periods[] = {63, 4000, 3 * 60 * 1000, 20 * 3600 * 1000};
+  uint64_t start = timer_get_time_ms();
+  for (unsigned i = 0; i < 4; i++) {
+    create(i, periods[i], false);
+    timer_start(&timers[i]);
+  }
+
+  timer_advance_time(21 * 3600 * 1000);
+  for (unsigned i = 0; i < 4; i++) {
+    EXPECT_EQ(1U, timerCalls[i]);
+    EXPECT_EQ(start + periods[i], timerLastCall[i]);
+  }
+}
+
+TEST_F(OsTimersTest, restart)
+{
+  create(0, 100, false);
+  timer_start(&timers[0]);
+  uint64_t start = timer_get_time_ms();
+  timer_advance_time(80);
+  timer_set_period(&timers[0], 100);
+  timer_advance_time(1000);
+  EXPECT_EQ(1U, timerCalls[0]);
+  EXPECT_EQ(start + 180, timerLastCall[0]);
+}
+
+TEST_F(OsTimersTest, asyncCall)
+{
+  asyncValue = 0;
+  async_call(asyncCallback, nullptr, nullptr, 42);
+  timer_advance_time(1);
+  EXPECT_EQ(42U, asyncValue);
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include "gtests.h"
+#include "pulses/channels_encoder.h"
+
+class ChannelsEncoderTest : public EdgeTxTest
+{
+ protected:
+  int16_t channels[16];
+  uint8_t frame[64];
+
+  void SetUp() override
+  {
+    EdgeTxTest::SetUp();
+    memset(frame, 0, sizeof(frame));
+
+    // ramp over [-125%;125%] to check clipping
+    for (int i = 0; i < 16; i++) {
+      channels[i] = -1280 + 171 * i;
+    }
+  }
+
+  template <class Format, class Crc = ChannelsNoCrc>
+  uint8_t encode(Crc& crc)
+  {
+    uint8_t* p = frame;
+    ChannelsEncoder<Format, Crc> encoder(p, crc);
+    encoder.addChannels(channels, 16, 0);
+    return p - frame;
+  }
+};
+
+TEST_F(ChannelsEncoderTest, sbus)
+{
+  const uint8_t expected[] = {
+      0x00, 0x48, 0x83, 0x3C, 0xF6, 0x42, 0x20, 0x46, 0x55, 0xCC, 0x73,
+      0x26, 0x7C, 0x25, 0x4E, 0x81, 0x9B, 0x64, 0x69, 0x6F, 0x9D, 0xFC,
+  };
+
+  ChannelsNoCrc crc;
+  EXPECT_EQ(sizeof(expected), encode<SbusChannelsFormat>(crc));
+  EXPECT_EQ(0, memcmp(expected, frame, sizeof(expected)));
+}
+
+TEST_F(ChannelsEncoderTest, multi)
+{
+  const uint8_t expected[] = {
+      0x00, 0x48, 0x84, 0x44, 0x36, 0x43, 0x22, 0x56, 0xD5, 0xCC, 0x77,
+      0x46, 0x7C, 0x26, 0x56, 0xC1, 0x9B, 0x66, 0x79, 0xEF, 0xFD, 0xFF,
+  };
+
+  ChannelsNoCrc crc;
+  EXPECT_EQ(sizeof(expected), encode<MultiChannelsFormat>(crc));
+  EXPECT_EQ(0, memcmp(expected, frame, sizeof(expected)));
+}
+
+TEST_F(ChannelsEncoderTest, multiFailsafe)
+{
+  const uint8_t expected[] = {
+      0x01, 0x48, 0x84, 0x44, 0xFE, 0x4F, 0x22, 0x00, 0xD4, 0xCC, 0x77,
+      0x46, 0x7C, 0x26, 0x56, 0xC1, 0x9B, 0x66, 0x79, 0xEF, 0xDD, 0xFF,
+  };
+
+  uint8_t* p = frame;
+  ChannelsNoCrc crc;
+  ChannelsEncoder<MultiFailsafeFormat> encoder(p, crc);
+  for (int i = 0; i < 16; i++) {
+    if (i == 3) {
+      encoder.addRaw(2047);  // hold
+    } else if (i == 5) {
+      encoder.addRaw(0);  // no pulses
+    } else {
+      encoder.add(channels[i]);
+    }
+  }
+
+  EXPECT_EQ(sizeof(expected), (size_t)(p - frame));
+  EXPECT_EQ(0, memcmp(expected, frame, sizeof(expected)));
+}
+
+TEST_F(ChannelsEncoderTest, pxx2)
+{
+  const uint8_t expected[] = {
+      0x40, 0x00, 0x0C, 0x40, 0x11, 0x1C, 0x41, 0x12, 0x2C, 0x42, 0x23, 0x3C,
+      0x42, 0x24, 0x4C, 0x42, 0x35, 0x5C, 0x43, 0x36, 0x6C, 0x44, 0x47, 0x7C,
+  };
+
+  ChannelsPxx2Crc crc = {0xFFFF};
+  EXPECT_EQ(sizeof(expected), encode<Pxx2ChannelsFormat>(crc));
+  EXPECT_EQ(0, memcmp(expected, frame, sizeof(expected)));
+  EXPECT_EQ(0xFAB5, crc.crc);
+}
+
+TEST_F(ChannelsEncoderTest, crossfireCrc)
+{
+  Crc8 crc;
+  auto len = encode<CrossfireChannelsFormat>(crc);
+  EXPECT_EQ(22, len);
+  EXPECT_EQ(crc8(frame, len), crc.get());
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) EdgeTX
+ *
+ * Based on code named
+ *   opentx - https://github.com/opentx/opentx
+ *   th9x - http://code.google.com/p/th9x
+ *   er9x - http://code.google.com/p/er9x
+ *   gruvin9x - http://code.google.com/p/gruvin9x
+ *
+ * License GPLv2: http://www.gnu.org/licenses/gpl-2.0.html
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include "gtests.h"
+#include "location.h"
+#include "ff.h"
+
+namespace fs = std::filesystem;
+
+class SimuFatfsTest : public testing::Test
+{
+ protected:
+  fs::path root;
+
+  void SetUp() override
+  {
+    root = fs::temp_directory_path() / "edgetx-simu-fatfs";
+    fs::remove_all(root);
+    fs::create_directories(root / "SOUNDS" / "en");
+    std::ofstream(root / "SOUNDS" / "en" / "Hello.wav") << "wav";
+    simuFatfsSetPaths(root.string().c_str(), nullptr);
+  }
+
+  void TearDown() override
+  {
+    simuFatfsSetPaths(TESTS_PATH, nullptr);
+    fs::remove_all(root);
+  }
+};
+
+TEST_F(SimuFatfsTest, caseInsensitivePaths)
+{
+  EXPECT_EQ((root / "SOUNDS" / "en" / "Hello.wav").string(),
+            simuFatfsGetRealPath("/sounds/EN/hello.WAV"));
+
+  // missing components are kept as is
+  EXPECT_EQ((root / "SOUNDS" / "fr" / "Hello.wav").string(),
+            simuFatfsGetRealPath("/sounds/fr/Hello.wav"));
+
+  FILINFO info;
+  EXPECT_EQ(FR_OK, f_stat("/Sounds/en/HELLO.wav", &info));
+  EXPECT_NE(FR_OK, f_stat("/Sounds/en/bye.wav", &info));
+}
+
+TEST_F(SimuFatfsTest, listingUpdates)
+{
+  FILINFO info;
+  EXPECT_NE(FR_OK, f_stat("/sounds/en/BYE.wav", &info));
+
+  // created by the simulator
+  FIL fil;
+  ASSERT_EQ(FR_OK, f_open(&fil, "/SOUNDS/en/Bye.wav", FA_CREATE_ALWAYS | FA_WRITE));
+  f_close(&fil);
+  EXPECT_EQ(FR_OK, f_stat("/sounds/en/BYE.wav", &info));
+
+  ASSERT_EQ(FR_OK, f_rename("/sounds/EN/bye.wav", "/SOUNDS/en/Later.wav"));
+  EXPECT_NE(FR_OK, f_stat("/sounds/en/BYE.wav", &info));
+  EXPECT_EQ(FR_OK, f_stat("/sounds/en/later.wav", &info));
+
+  ASSERT_EQ(FR_OK, f_unlink("/sounds/en/LATER.wav"));
+  EXPECT_NE(FR_OK, f_stat("/sounds/en/later.wav", &info));
+
+  ASSERT_EQ(FR_OK, f_mkdir("/Sounds/De"));
+  EXPECT_EQ((root / "SOUNDS" / "De").string(),
+            simuFatfsGetRealPath("/sounds/de"));
+
+  // created outside of the simulator (after the directory
+  // timestamp granularity)
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  std::ofstream(root / "SOUNDS" / "en" / "Extern.wav") << "wav";
+  EXPECT_EQ(FR_OK, f_stat("/sounds/en/extern.wav", &info));
+}
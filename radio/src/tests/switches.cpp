@@ -428,3 +428,89 @@ TEST(FlexSwitches, getSwitch)
   EXPECT_FALSE(getSwitch(SWSRC_FIRST_SWITCH + sw_idx * 3 + 1));
   EXPECT_TRUE(getSwitch(SWSRC_FIRST_SWITCH + sw_idx * 3 + 2));
 }
+
+TEST(getSwitch, cache)
+{
+  RADIO_RESET();
+  MODEL_RESET();
+  MIXER_RESET();
+
+  // switches in every position, 2POS switch in a 3POS slot included
+  for (int sw = 0; sw < switchGetMaxSwitches(); sw++) {
+    g_eeGeneral.switchSetType(sw, sw & 1 ? SWITCH_2POS : SWITCH_3POS);
+  }
+
+  for (int state = -1; state <= 1; state++) {
+    for (int sw = 0; sw < switchGetMaxSwitches(); sw++) {
+      simuSetSwitch(sw, sw & 1 ? -state : state);
+    }
+
+    switchesCacheUpdate();
+    bool cached[SWSRC_COUNT];
+    for (int i = SWSRC_FIRST_SWITCH; i < SWSRC_COUNT; i++) {
+      cached[i] = getSwitch(i);
+    }
+    switchesCacheInvalidate();
+
+    for (int i = SWSRC_FIRST_SWITCH; i < SWSRC_COUNT; i++) {
+      EXPECT_EQ(getSwitch(i), cached[i]) << "swtch " << i;
+      EXPECT_EQ(getSwitch(-i), !cached[i]) << "swtch " << -i;
+    }
+  }
+
+  RADIO_RESET();
+}
+
+TEST(evalLogicalSwitches, dependencyOrder)
+{
+  RADIO_RESET();
+  MODEL_RESET();
+  MIXER_RESET();
+
+  // L1 = L2 AND L3, L2 = L3 OR ON, L3 = ON: all true after one run
+  setLogicalSwitch(0, LS_FUNC_AND, SWSRC_FIRST_LOGICAL_SWITCH + 1,
+                   SWSRC_FIRST_LOGICAL_SWITCH + 2);
+  setLogicalSwitch(1, LS_FUNC_OR, SWSRC_FIRST_LOGICAL_SWITCH + 2, SWSRC_ON);
+  setLogicalSwitch(2, LS_FUNC_AND, SWSRC_ON, SWSRC_ON);
+  logicalSwitchesInvalidateOrder();
+
+  evalLogicalSwitches();
+  EXPECT_TRUE(getSwitch(SWSRC_FIRST_LOGICAL_SWITCH + 2));
+  EXPECT_TRUE(getSwitch(SWSRC_FIRST_LOGICAL_SWITCH + 1));
+  EXPECT_TRUE(getSwitch(SWSRC_FIRST_LOGICAL_SWITCH));
+  EXPECT_FALSE(logicalSwitchIsInCycle(0));
+
+  // AND switch dependency
+  setLogicalSwitch(3, LS_FUNC_AND, SWSRC_ON, SWSRC_ON, 0, 0, 0,
+                   SWSRC_FIRST_LOGICAL_SWITCH + 4);
+  setLogicalSwitch(4, LS_FUNC_OR, SWSRC_ON, SWSRC_NONE);
+  logicalSwitchesInvalidateOrder();
+  evalLogicalSwitches();
+  EXPECT_TRUE(getSwitch(SWSRC_FIRST_LOGICAL_SWITCH + 3));
+}
+
+TEST(evalLogicalSwitches, cycles)
+{
+  RADIO_RESET();
+  MODEL_RESET();
+  MIXER_RESET();
+
+  // L1 <-> L2 cycle, L3 depends on the cycle, L4 is independent
+  setLogicalSwitch(0, LS_FUNC_OR, SWSRC_FIRST_LOGICAL_SWITCH + 1, SWSRC_ON);
+  setLogicalSwitch(1, LS_FUNC_OR, SWSRC_FIRST_LOGICAL_SWITCH, SWSRC_OFF);
+  setLogicalSwitch(2, LS_FUNC_AND, SWSRC_FIRST_LOGICAL_SWITCH, SWSRC_ON);
+  setLogicalSwitch(3, LS_FUNC_AND, SWSRC_ON, SWSRC_ON);
+  logicalSwitchesInvalidateOrder();
+
+  EXPECT_TRUE(logicalSwitchIsInCycle(0));
+  EXPECT_TRUE(logicalSwitchIsInCycle(1));
+  EXPECT_FALSE(logicalSwitchIsInCycle(2));
+  EXPECT_FALSE(logicalSwitchIsInCycle(3));
+
+  // cycle members are evaluated in index order, before their dependents
+  evalLogicalSwitches();
+  EXPECT_TRUE(getSwitch(SWSRC_FIRST_LOGICAL_SWITCH));
+  EXPECT_TRUE(getSwitch(SWSRC_FIRST_LOGICAL_SWITCH + 1));
+  EXPECT_TRUE(getSwitch(SWSRC_FIRST_LOGICAL_SWITCH + 2));
+  EXPECT_TRUE(getSwitch(SWSRC_FIRST_LOGICAL_SWITCH + 3));
+}